@@ -0,0 +1,210 @@
+// std::copy and std::sort over an ArrayList through its contiguous iterator,
+// its raw pointers and std::ranges, against the same items behind an
+// iterator that is only random access, as ArrayListIterator used to be.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include ArrayListIteratorBenchmark.cpp && ./a.out
+#include "ArrayList.hpp"
+#include "Benchmark.hpp"
+
+#include <algorithm> // std::copy, std::sort, std::ranges::copy, std::ranges::sort
+#include <compare>   // std::strong_ordering
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdio>    // std::printf, std::snprintf
+#include <iterator>  // std::random_access_iterator_tag, std::contiguous_iterator
+#include <random>    // std::mt19937
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr int REPEATS{5};
+
+    // Random access over the items of an ArrayList, but not contiguous, so
+    // the library can't tell that a block copy would do.
+    template <typename T>
+    class RandomAccessIterator
+    {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using pointer           = T*;
+        using reference         = T&;
+
+        RandomAccessIterator() = default;
+
+        explicit RandomAccessIterator(T* item) : m_item{item}
+        {
+        }
+
+        reference operator*() const
+        {
+            return *m_item;
+        }
+
+        reference operator[](const difference_type n) const
+        {
+            return m_item[n];
+        }
+
+        RandomAccessIterator& operator++()
+        {
+            ++m_item;
+            return *this;
+        }
+
+        RandomAccessIterator operator++(int)
+        {
+            return RandomAccessIterator{m_item++};
+        }
+
+        RandomAccessIterator& operator--()
+        {
+            --m_item;
+            return *this;
+        }
+
+        RandomAccessIterator operator--(int)
+        {
+            return RandomAccessIterator{m_item--};
+        }
+
+        RandomAccessIterator& operator+=(const difference_type n)
+        {
+            m_item += n;
+            return *this;
+        }
+
+        RandomAccessIterator& operator-=(const difference_type n)
+        {
+            m_item -= n;
+            return *this;
+        }
+
+        friend RandomAccessIterator operator+(RandomAccessIterator it, const difference_type n)
+        {
+            return it += n;
+        }
+
+        friend RandomAccessIterator operator+(const difference_type n, RandomAccessIterator it)
+        {
+            return it += n;
+        }
+
+        friend RandomAccessIterator operator-(RandomAccessIterator it, const difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const RandomAccessIterator& lhs,
+                                         const RandomAccessIterator& rhs)
+        {
+            return lhs.m_item - rhs.m_item;
+        }
+
+        friend bool operator==(const RandomAccessIterator&, const RandomAccessIterator&) = default;
+
+        friend std::strong_ordering operator<=>(const RandomAccessIterator&,
+                                                const RandomAccessIterator&) = default;
+
+    private:
+        T* m_item{nullptr};
+    };
+
+    static_assert(std::contiguous_iterator<ArrayList<int>::iterator>);
+    static_assert(std::random_access_iterator<RandomAccessIterator<int>>);
+    static_assert(!std::contiguous_iterator<RandomAccessIterator<int>>);
+
+    void copy(const std::size_t size)
+    {
+        ArrayList<int>   list;
+        std::vector<int> out(size);
+        for (std::size_t i{}; i < size; ++i)
+        {
+            list.append(static_cast<int>(i));
+        }
+
+        const int rounds{static_cast<int>(50'000'000 / size) + 1};
+        char      name[64];
+
+        const auto time = [&](const char* how, auto&& call) {
+            const double ns = bench::best_ns(REPEATS, [&call, &out, rounds] {
+                for (int round{}; round < rounds; ++round)
+                {
+                    call();
+                    bench::do_not_optimize(out);
+                }
+            });
+            std::snprintf(name, sizeof(name), "copy %-20s %9zu items", how, size);
+            bench::report(name, ns, static_cast<double>(size) * rounds);
+        };
+
+        time("iterator", [&] { std::copy(list.begin(), list.end(), out.begin()); });
+        time("ranges", [&] { std::ranges::copy(list, out.begin()); });
+        time("pointer", [&] { std::copy(list.data(), list.data() + size, out.data()); });
+        time("random access", [&] {
+            std::copy(RandomAccessIterator<int>{list.data()},
+                      RandomAccessIterator<int>{list.data() + size},
+                      out.begin());
+        });
+    }
+
+    void sort(const std::size_t size)
+    {
+        std::vector<int> shuffled(size);
+        std::mt19937     gen{2024};
+        for (auto& item : shuffled)
+        {
+            item = static_cast<int>(gen());
+        }
+
+        const int rounds{static_cast<int>(2'000'000 / size) + 1};
+        char      name[64];
+
+        // Sorting is timed together with refilling the list, which is the
+        // same for every way of sorting.
+        const auto time = [&](const char* how, auto&& sort_list) {
+            const double ns = bench::best_ns(REPEATS, [&] {
+                for (int round{}; round < rounds; ++round)
+                {
+                    ArrayList<int> list;
+                    list.reserve(size);
+                    for (const int item : shuffled)
+                    {
+                        list.append(item);
+                    }
+                    sort_list(list);
+                    bench::do_not_optimize(list[0]);
+                }
+            });
+            std::snprintf(name, sizeof(name), "sort %-20s %9zu items", how, size);
+            bench::report(name, ns, static_cast<double>(size) * rounds);
+        };
+
+        time("iterator", [](ArrayList<int>& list) { std::sort(list.begin(), list.end()); });
+        time("ranges", [](ArrayList<int>& list) { std::ranges::sort(list); });
+        time("pointer", [](ArrayList<int>& list) {
+            std::sort(list.data(), list.data() + list.size());
+        });
+        time("random access", [](ArrayList<int>& list) {
+            std::sort(RandomAccessIterator<int>{list.data()},
+                      RandomAccessIterator<int>{list.data() + list.size()});
+        });
+    }
+} // namespace
+
+int main()
+{
+    std::printf("ArrayList<int>, best of %d runs\n", REPEATS);
+
+    for (const std::size_t size : {1'000, 1'000'000})
+    {
+        copy(size);
+    }
+    for (const std::size_t size : {1'000, 1'000'000})
+    {
+        sort(size);
+    }
+
+    return 0;
+}
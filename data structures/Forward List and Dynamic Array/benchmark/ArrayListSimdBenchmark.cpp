@@ -0,0 +1,114 @@
+// The vector kernels of ArrayListSimd.hpp against the scalar loops, for
+// find, count, min, max and sum over int32_t, int64_t, float and double.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include ArrayListSimdBenchmark.cpp && ./a.out
+#include "ArrayListSimd.hpp"
+#include "Benchmark.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::int32_t, std::int64_t
+#include <cstdio>  // std::printf, std::snprintf
+#include <vector>  // std::vector
+
+namespace
+{
+    constexpr std::size_t SIZE{1 << 16}; // Fits in L2, so the kernels are timed, not memory.
+    constexpr int         ROUNDS{200};
+    constexpr int         REPEATS{5};
+
+    // find, count, min, max and sum of one kernel set over "data".
+    template <typename T, typename Kernels>
+    void run_kernels(const char* type, const char* kernels, const std::vector<T>& data)
+    {
+        const T*          items = data.data();
+        const std::size_t size{data.size()};
+        const T           absent{static_cast<T>(-1)}; // find scans everything.
+        const double      count{static_cast<double>(size) * ROUNDS};
+        char              name[64];
+
+        const auto time = [&](const char* op, auto&& call) {
+            const double ns = bench::best_ns(REPEATS, [&call] {
+                for (int round{}; round < ROUNDS; ++round)
+                {
+                    bench::do_not_optimize(call());
+                }
+            });
+            std::snprintf(name, sizeof(name), "%-7s %-6s %s", type, op, kernels);
+            bench::report(name, ns, count);
+        };
+
+        time("find", [&] { return Kernels::find(items, size, absent); });
+        time("count", [&] { return Kernels::count(items, size, absent); });
+        time("min", [&] { return Kernels::min(items, size); });
+        time("max", [&] { return Kernels::max(items, size); });
+        time("sum", [&] { return Kernels::sum(items, size); });
+    }
+
+    // What the ArrayList members call, picking a kernel at run time.
+    template <typename T>
+    struct Dispatch
+    {
+        static std::size_t find(const T* data, const std::size_t size, const T value)
+        {
+            return arraylist_simd::find(data, size, value);
+        }
+
+        static std::size_t count(const T* data, const std::size_t size, const T value)
+        {
+            return arraylist_simd::count(data, size, value);
+        }
+
+        static T min(const T* data, const std::size_t size)
+        {
+            return arraylist_simd::min(data, size);
+        }
+
+        static T max(const T* data, const std::size_t size)
+        {
+            return arraylist_simd::max(data, size);
+        }
+
+        static T sum(const T* data, const std::size_t size)
+        {
+            return arraylist_simd::sum(data, size);
+        }
+    };
+
+    template <typename T>
+    void run(const char* type)
+    {
+        // Small values, so the sums of the integers don't overflow.
+        std::vector<T> data(SIZE);
+        for (std::size_t i{}; i < SIZE; ++i)
+        {
+            data[i] = static_cast<T>(i % 100);
+        }
+
+        run_kernels<T, arraylist_simd::Scalar<T>>(type, "scalar", data);
+        run_kernels<T, Dispatch<T>>(type, "dispatch", data);
+
+#ifdef ARRAYLIST_SIMD_X86
+        if (arraylist_simd::has_sse2())
+        {
+            run_kernels<T, arraylist_simd::sse2_kernels<T>>(type, "sse2", data);
+        }
+        if (arraylist_simd::has_avx2())
+        {
+            run_kernels<T, arraylist_simd::avx2_kernels<T>>(type, "avx2", data);
+        }
+#endif
+    }
+} // namespace
+
+int main()
+{
+    std::printf("%zu items, %d rounds per run, best of %d runs\n", SIZE, ROUNDS, REPEATS);
+
+    run<std::int32_t>("int32");
+    run<std::int64_t>("int64");
+    run<float>("float");
+    run<double>("double");
+
+    return 0;
+}
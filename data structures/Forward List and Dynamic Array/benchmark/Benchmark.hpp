@@ -0,0 +1,47 @@
+// Small timing helpers shared by the benchmarks in this directory.
+// Build a benchmark from this directory with optimizations on, e.g.:
+//   g++ -std=c++20 -O2 -I../include SomeBenchmark.cpp && ./a.out
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <algorithm> // std::min
+#include <chrono>    // std::chrono::steady_clock
+#include <cstdio>    // std::printf
+#include <limits>    // std::numeric_limits
+
+namespace bench
+{
+    // Make the compiler assume "value" is read, so computing it isn't
+    // optimized away. GCC and Clang only, like ArrayListSimd.hpp.
+    template <typename T>
+    inline void do_not_optimize(const T& value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Run "body" "repeats" times and return the fastest run in nanoseconds.
+    // The fastest run is the one least disturbed by the rest of the system.
+    template <typename Body>
+    double best_ns(const int repeats, Body&& body)
+    {
+        double best{std::numeric_limits<double>::max()};
+
+        for (int run{}; run < repeats; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            body();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        return best;
+    }
+
+    // Print one result: what was measured, the time, and the time per item.
+    inline void report(const char* name, const double ns, const double items)
+    {
+        std::printf("%-44s %10.3f ms %9.3f ns/item\n", name, ns / 1e6, ns / items);
+    }
+} // namespace bench
+
+#endif // BENCHMARK_HPP
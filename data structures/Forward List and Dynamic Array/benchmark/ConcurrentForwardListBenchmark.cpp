@@ -0,0 +1,129 @@
+// Append throughput of ConcurrentForwardList against a ForwardList behind a
+// mutex, with 1 to 32 producer threads and one consumer draining the items.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -pthread -I../include ConcurrentForwardListBenchmark.cpp && ./a.out
+#include "Benchmark.hpp"
+#include "ConcurrentForwardList.hpp"
+#include "ForwardList.hpp"
+
+#include <atomic>  // std::atomic
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf, std::snprintf
+#include <mutex>   // std::mutex, std::lock_guard
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+namespace
+{
+    constexpr std::size_t TOTAL_ITEMS{1 << 21}; // Split among the producers.
+    constexpr int         REPEATS{5};
+
+    // What a trace buffer would hold.
+    struct TraceEvent
+    {
+        std::size_t producer;
+        std::size_t sequence;
+    };
+
+    // A ForwardList made safe for many producers the usual way.
+    class LockedForwardList
+    {
+    public:
+        void append(const TraceEvent& event)
+        {
+            const std::lock_guard<std::mutex> lock{m_mutex};
+            m_list.append(event);
+        }
+
+        // Swap the items out under the lock, then hand them over.
+        template <typename Consumer>
+        std::size_t drain(Consumer&& consume)
+        {
+            ForwardList<TraceEvent> taken;
+            {
+                const std::lock_guard<std::mutex> lock{m_mutex};
+                taken = std::move(m_list);
+                m_list.clear(); // A moved-from list is valid but unspecified.
+            }
+
+            std::size_t count{};
+            for (const auto& event : taken)
+            {
+                consume(event);
+                ++count;
+            }
+            return count;
+        }
+
+    private:
+        std::mutex              m_mutex;
+        ForwardList<TraceEvent> m_list;
+    };
+
+    // Run "producers" threads appending TOTAL_ITEMS items in all while this
+    // thread drains them, until every item is taken.
+    template <typename ListT>
+    void run(ListT& list, const std::size_t producers)
+    {
+        const std::size_t per_producer{TOTAL_ITEMS / producers};
+        std::atomic<bool> go{false};
+
+        std::vector<std::thread> threads;
+        for (std::size_t id{}; id < producers; ++id)
+        {
+            threads.emplace_back([&list, &go, id, per_producer] {
+                while (!go.load(std::memory_order_acquire))
+                {
+                }
+                for (std::size_t i{}; i < per_producer; ++i)
+                {
+                    list.append(TraceEvent{id, i});
+                }
+            });
+        }
+
+        std::size_t checksum{};
+        std::size_t taken{};
+
+        go.store(true, std::memory_order_release);
+        while (taken < per_producer * producers)
+        {
+            taken += list.drain([&checksum](const TraceEvent& event) {
+                checksum += event.sequence;
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        bench::do_not_optimize(checksum);
+    }
+} // namespace
+
+int main()
+{
+    std::printf("%zu appends per run, best of %d runs\n", TOTAL_ITEMS, REPEATS);
+
+    for (const std::size_t producers : {1, 2, 4, 8, 16, 32})
+    {
+        char name[64];
+
+        const double lock_free = bench::best_ns(REPEATS, [producers] {
+            ConcurrentForwardList<TraceEvent> list;
+            run(list, producers);
+        });
+        std::snprintf(name, sizeof(name), "ConcurrentForwardList, %2zu producers", producers);
+        bench::report(name, lock_free, TOTAL_ITEMS);
+
+        const double locked = bench::best_ns(REPEATS, [producers] {
+            LockedForwardList list;
+            run(list, producers);
+        });
+        std::snprintf(name, sizeof(name), "ForwardList + mutex,   %2zu producers", producers);
+        bench::report(name, locked, TOTAL_ITEMS);
+    }
+
+    return 0;
+}
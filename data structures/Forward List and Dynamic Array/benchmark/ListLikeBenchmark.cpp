@@ -0,0 +1,87 @@
+// Summing an ArrayList<int> through the virtual List interface against
+// generic code constrained on the ListLike concept.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include ListLikeBenchmark.cpp && ./a.out
+#include "ArrayList.hpp"
+#include "Benchmark.hpp"
+#include "List.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf, std::snprintf
+
+namespace
+{
+    constexpr int REPEATS{20};
+
+    // Every size() and operator[] is an indirect call through List's vtable.
+    [[gnu::noinline]]
+    long long sum_virtual(const List<int>& list)
+    {
+        long long total{};
+        for (std::size_t i{}; i < list.size(); ++i)
+        {
+            total += list[i];
+        }
+        return total;
+    }
+
+    // The calls bind to the members of L, so they inline and vectorize.
+    template <ListLike L>
+    [[gnu::noinline]]
+    long long sum_list_like(const L& list)
+    {
+        long long total{};
+        for (std::size_t i{}; i < list.size(); ++i)
+        {
+            total += list[i];
+        }
+        return total;
+    }
+
+    void run(const std::size_t size)
+    {
+        ArrayList<int> list;
+        for (std::size_t i{}; i < size; ++i)
+        {
+            list.append(static_cast<int>(i % 1000));
+        }
+
+        // Hide the dynamic type, or the compiler could devirtualize the calls.
+        const List<int>* base = &list;
+        asm volatile("" : "+r"(base));
+
+        const int rounds{static_cast<int>(100'000'000 / size)};
+        char      name[64];
+
+        const double virtual_ns = bench::best_ns(REPEATS, [base, rounds] {
+            for (int round{}; round < rounds; ++round)
+            {
+                bench::do_not_optimize(sum_virtual(*base));
+            }
+        });
+        std::snprintf(name, sizeof(name), "List<int>& (virtual), %zu items", size);
+        bench::report(name, virtual_ns, static_cast<double>(size) * rounds);
+
+        const double list_like_ns = bench::best_ns(REPEATS, [&list, rounds] {
+            for (int round{}; round < rounds; ++round)
+            {
+                bench::do_not_optimize(sum_list_like(list));
+            }
+        });
+        std::snprintf(name, sizeof(name), "ListLike (static), %zu items", size);
+        bench::report(name, list_like_ns, static_cast<double>(size) * rounds);
+    }
+} // namespace
+
+int main()
+{
+    std::printf("Sum of an ArrayList<int>, best of %d runs\n", REPEATS);
+
+    for (const std::size_t size : {1'000, 100'000, 10'000'000})
+    {
+        run(size);
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Summing one field of every row: a SoAArrayList column against a loop over
+// ArrayList<Record>, for a narrow record and a wide one.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include SoAArrayListBenchmark.cpp && ./a.out
+#include "ArrayList.hpp"
+#include "Benchmark.hpp"
+#include "SoAArrayList.hpp"
+
+#include <cstddef> // std::size_t
+#include <cstdio>  // std::printf, std::snprintf
+
+namespace
+{
+    constexpr std::size_t ROWS{1'000'000};
+    constexpr int         ROUNDS{50};
+    constexpr int         REPEATS{5};
+
+    // The record of the SoAArrayList doc, 24 bytes.
+    struct Narrow
+    {
+        int    id;
+        double price;
+        int    qty;
+    };
+
+    // A record with more fields the scan doesn't need, 48 bytes.
+    struct Wide
+    {
+        int       id;
+        double    price;
+        int       qty;
+        double    cost;
+        double    tax;
+        long long timestamp;
+    };
+
+    // Time summing the price of every row, first with the rows in an
+    // ArrayList<Record>, then with the columns of "soa".
+    template <typename Record, typename SoA>
+    void run(const char* record, const ArrayList<Record>& aos, const SoA& soa)
+    {
+        char name[64];
+
+        const double aos_ns = bench::best_ns(REPEATS, [&aos] {
+            for (int round{}; round < ROUNDS; ++round)
+            {
+                double total{};
+                for (const Record& row : aos)
+                {
+                    total += row.price;
+                }
+                bench::do_not_optimize(total);
+            }
+        });
+        std::snprintf(name, sizeof(name), "ArrayList<%s>, sum of price", record);
+        bench::report(name, aos_ns, static_cast<double>(ROWS) * ROUNDS);
+
+        const double soa_ns = bench::best_ns(REPEATS, [&soa] {
+            for (int round{}; round < ROUNDS; ++round)
+            {
+                double total{};
+                for (const double price : soa.template column<1>())
+                {
+                    total += price;
+                }
+                bench::do_not_optimize(total);
+            }
+        });
+        std::snprintf(name, sizeof(name), "SoAArrayList (%s), sum of price", record);
+        bench::report(name, soa_ns, static_cast<double>(ROWS) * ROUNDS);
+    }
+} // namespace
+
+int main()
+{
+    std::printf("%zu rows, %d rounds per run, best of %d runs\n", ROWS, ROUNDS, REPEATS);
+
+    {
+        ArrayList<Narrow>              aos;
+        SoAArrayList<int, double, int> soa;
+        for (std::size_t i{}; i < ROWS; ++i)
+        {
+            const auto id = static_cast<int>(i);
+            aos.append(Narrow{id, 0.5 * id, id % 10});
+            soa.append(id, 0.5 * id, id % 10);
+        }
+        run("Narrow", aos, soa);
+    }
+
+    {
+        ArrayList<Wide>                                           aos;
+        SoAArrayList<int, double, int, double, double, long long> soa;
+        for (std::size_t i{}; i < ROWS; ++i)
+        {
+            const auto id = static_cast<int>(i);
+            aos.append(Wide{id, 0.5 * id, id % 10, 0.25 * id, 0.1 * id, id * 1000LL});
+            soa.append(id, 0.5 * id, id % 10, 0.25 * id, 0.1 * id, id * 1000LL);
+        }
+        run("Wide", aos, soa);
+    }
+
+    return 0;
+}
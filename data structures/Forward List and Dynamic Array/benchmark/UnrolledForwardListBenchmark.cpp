@@ -0,0 +1,121 @@
+// Positional access and iteration: UnrolledForwardList against ForwardList,
+// for int items and 64-byte items.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include UnrolledForwardListBenchmark.cpp && ./a.out
+#include "Benchmark.hpp"
+#include "ForwardList.hpp"
+#include "UnrolledForwardList.hpp"
+
+#include <cstddef>     // std::size_t
+#include <cstdio>      // std::printf, std::snprintf
+#include <random>      // std::mt19937, std::uniform_int_distribution
+#include <type_traits> // std::is_same_v
+#include <vector>      // std::vector
+
+namespace
+{
+    constexpr std::size_t ITERATED{1'000'000}; // Items of the iterated lists.
+    constexpr std::size_t INDEXED{10'000};     // Items of the indexed lists.
+    constexpr std::size_t LOOKUPS{2'000};      // Random positions per run.
+    constexpr int         REPEATS{5};
+
+    // An item the size of a cache line.
+    struct Payload
+    {
+        char bytes[64];
+    };
+
+    // Item number "i" of a list.
+    template <typename T>
+    T make(const std::size_t i)
+    {
+        if constexpr (std::is_same_v<T, Payload>)
+        {
+            Payload payload{};
+            payload.bytes[0] = static_cast<char>(i);
+            return payload;
+        }
+        else
+        {
+            return static_cast<T>(i);
+        }
+    }
+
+    long long key(const Payload& payload)
+    {
+        return payload.bytes[0];
+    }
+
+    long long key(const int item)
+    {
+        return item;
+    }
+
+    template <typename ListT>
+    ListT filled(const std::size_t size)
+    {
+        ListT list;
+        for (std::size_t i{}; i < size; ++i)
+        {
+            list.append(make<typename ListT::value_type>(i));
+        }
+        return list;
+    }
+
+    template <typename ListT>
+    void run(const char* list_name, const char* item_name)
+    {
+        char name[64];
+
+        const ListT iterated{filled<ListT>(ITERATED)};
+
+        const double iterate_ns = bench::best_ns(REPEATS, [&iterated] {
+            long long total{};
+            for (const auto& item : iterated)
+            {
+                total += key(item);
+            }
+            bench::do_not_optimize(total);
+        });
+        std::snprintf(name, sizeof(name), "%s<%s>, iterate", list_name, item_name);
+        bench::report(name, iterate_ns, ITERATED);
+
+        const ListT indexed{filled<ListT>(INDEXED)};
+
+        std::mt19937                               gen{2024};
+        std::uniform_int_distribution<std::size_t> position{0, INDEXED - 1};
+        std::vector<std::size_t>                   positions(LOOKUPS);
+        for (auto& pos : positions)
+        {
+            pos = position(gen);
+        }
+
+        const double index_ns = bench::best_ns(REPEATS, [&indexed, &positions] {
+            long long total{};
+            for (const std::size_t pos : positions)
+            {
+                total += key(indexed[pos]);
+            }
+            bench::do_not_optimize(total);
+        });
+        std::snprintf(name, sizeof(name), "%s<%s>, operator[]", list_name, item_name);
+        bench::report(name, index_ns, LOOKUPS);
+    }
+} // namespace
+
+int main()
+{
+    std::printf("Iterating %zu items, %zu random operator[] on %zu items, best of %d runs\n",
+                ITERATED,
+                LOOKUPS,
+                INDEXED,
+                REPEATS);
+
+    run<ForwardList<int>>("ForwardList", "int");
+    run<UnrolledForwardList<int>>("UnrolledForwardList", "int");
+    run<ForwardList<Payload>>("ForwardList", "Payload");
+    run<UnrolledForwardList<Payload>>("UnrolledForwardList", "Payload");
+
+    return 0;
+}
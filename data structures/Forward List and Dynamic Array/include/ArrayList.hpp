@@ -3,15 +3,34 @@
 #define ARRAYLIST_HPP
 
 #include "ArrayListIterator.hpp"
+#include "ArrayListSimd.hpp"
+#include "GrowthPolicy.hpp"
 #include "List.hpp"
 
-#include <iostream> // operator<<
-#include <utility>  // std::move, std::exchange
-
-constexpr std::size_t INITIAL_SIZE{2};
-constexpr std::size_t GROWTH_FACTOR{2};
-
-template <typename T>
+#include <algorithm>        // std::move, std::move_backward, std::copy_n
+#include <cstddef>          // std::ptrdiff_t
+#include <cstring>          // std::memcpy, std::memmove
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <iterator>         // std::input_iterator, std::sentinel_for
+#include <memory>           // std::allocator, std::allocator_traits
+#include <memory_resource>  // std::pmr::polymorphic_allocator
+#include <ranges>           // std::ranges::input_range
+#include <stdexcept>        // std::out_of_range
+#include <type_traits>      // std::is_trivially_copyable_v, std::is_arithmetic_v
+#include <utility>          // std::move, std::exchange, std::forward, std::swap
+
+/**
+ * @brief A list stored in a contiguous, growing array.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam Allocator Where the array comes from.
+ * @tparam Growth How much the array grows once it is full, see
+ * GrowthPolicy.hpp.
+ */
+template <typename T,
+          typename Allocator  = std::allocator<T>,
+          GrowthPolicy Growth = DoublingGrowth>
 class ArrayList : public List<T>
 {
 public:
@@ -20,59 +39,357 @@ public:
     using reference       = typename List<T>::reference;
     using const_reference = typename List<T>::const_reference;
     using pointer         = typename List<T>::pointer;
+    using const_pointer   = const value_type*;
+    using iterator        = ArrayListIterator<value_type>;
+    using const_iterator  = ArrayListIterator<const value_type>;
+    using allocator_type  = Allocator;
 
 private:
-    size_type m_capacity{};   // Maximum size of list.
-    size_type m_size{};       // Current number of list elements.
-    pointer   m_list_array{}; // Array holding list of elements.
+    using alloc_traits = std::allocator_traits<allocator_type>;
+
+    static_assert(std::is_same_v<typename alloc_traits::value_type, value_type>,
+                  "Allocator must allocate value_type.");
+    static_assert(std::is_same_v<typename alloc_traits::pointer, pointer>,
+                  "Allocator must use raw pointers.");
+
+    size_type m_capacity{}; // Maximum size of list.
+    size_type m_size{};     // Current number of list elements.
+    // Raw storage holding list of elements.
+    // Only [0, m_size) holds constructed elements, the rest is uninitialized.
+    pointer m_list_array{};
+    // Where the storage comes from. Takes no space when it is stateless.
+    [[no_unique_address]] allocator_type m_allocator{};
+
+    // Allocate storage for "count" elements without constructing them.
+    pointer allocate(const size_type count)
+    {
+        if (count == 0)
+        {
+            return nullptr;
+        }
+
+        return alloc_traits::allocate(m_allocator, count);
+    }
+
+    // Give the storage of "count" elements back.
+    // Elements must be destroyed beforehand.
+    void deallocate(pointer ptr, const size_type count) noexcept
+    {
+        if (ptr != nullptr)
+        {
+            alloc_traits::deallocate(m_allocator, ptr, count);
+        }
+    }
+
+    // Construct an element in raw storage through the allocator, so that
+    // e.g. polymorphic allocators can pass themselves down to the element.
+    template <typename... Args>
+    void construct(pointer ptr, Args&&... args)
+    {
+        alloc_traits::construct(m_allocator, ptr, std::forward<Args>(args)...);
+    }
+
+    // Destroy the elements in [first, last).
+    void destroy(pointer first, pointer last) noexcept
+    {
+        if constexpr (!std::is_trivially_destructible_v<value_type>)
+        {
+            for (; first != last; ++first)
+            {
+                alloc_traits::destroy(m_allocator, first);
+            }
+        }
+    }
 
-    void reserve()
+    // Construct "count" elements from "first" into raw "dest".
+    // If one of them throws, the ones already built are destroyed.
+    template <typename It>
+    void uninitialized_copy_n(It first, const size_type count, pointer dest)
     {
-        if (m_capacity == 0)
+        size_type built{};
+
+        try
+        {
+            for (; built < count; ++built, ++first)
+            {
+                construct(dest + built, *first);
+            }
+        }
+        catch (...)
         {
-            m_capacity = INITIAL_SIZE;
+            destroy(dest, dest + built);
+            throw;
+        }
+    }
+
+    // Move construct [first, last) into raw "dest".
+    void uninitialized_move(pointer first, pointer last, pointer dest)
+    {
+        uninitialized_copy_n(std::make_move_iterator(first),
+                             static_cast<size_type>(last - first),
+                             dest);
+    }
+
+    // Move the live elements into "dest" and end the lifetime of the
+    // originals. "dest" must have room for at least m_size elements.
+    void relocate(pointer dest)
+    {
+        if constexpr (std::is_trivially_copyable_v<value_type>)
+        {
+            // Trivially copyable types are just bytes, one block copy is
+            // enough and there is nothing to destroy.
+            if (m_size != 0)
+            {
+                std::memcpy(dest, m_list_array, m_size * sizeof(value_type));
+            }
         }
         else
         {
-            m_capacity *= GROWTH_FACTOR;
+            uninitialized_move(m_list_array, m_list_array + m_size, dest);
+            destroy(m_list_array, m_list_array + m_size);
+        }
+    }
+
+    // Destroy the live elements and free the storage.
+    void release() noexcept
+    {
+        destroy(m_list_array, m_list_array + m_size);
+        deallocate(m_list_array, m_capacity);
+    }
+
+    // Take over the storage of "other", whose allocator must be able to
+    // free it. The allocators themselves are left alone.
+    void take(ArrayList& other) noexcept
+    {
+        m_capacity   = std::exchange(other.m_capacity, 0);
+        m_size       = std::exchange(other.m_size, 0);
+        m_list_array = std::exchange(other.m_list_array, nullptr);
+    }
+
+    // Move the elements into new storage of exactly "new_capacity" slots,
+    // which must be at least m_size.
+    void reallocate(const size_type new_capacity)
+    {
+        // Allocate new storage in the heap, nothing is constructed yet.
+        pointer temp = allocate(new_capacity);
+
+        try
+        {
+            relocate(temp); // Move all items of original array.
+        }
+        catch (...)
+        {
+            deallocate(temp, new_capacity); // Original array is untouched.
+            throw;
         }
 
-        pointer temp =
-            new value_type[m_capacity]; // Allocate new array in the heap.
+        deallocate(m_list_array, m_capacity); // Get rid of the original array.
+        m_list_array = temp; // "temp" is our new array now.
+        m_capacity   = new_capacity;
+    }
+
+    // Make room for one more element as the growth policy says.
+    void grow()
+    {
+        reallocate(Growth::grow(m_capacity, m_size + 1));
+    }
+
+    // Grow so that "count" items constructed from "first" sit at "pos".
+    // The old elements are moved around the gap straight into the new
+    // storage, so nothing is shifted twice.
+    template <typename It>
+    void grow_insert(const size_type pos, const size_type count, It first)
+    {
+        const size_type new_capacity{Growth::grow(m_capacity, m_size + count)};
+
+        pointer temp = allocate(new_capacity);
+        pointer gap  = temp + pos;
 
-        for (size_type i{}; i < m_size; ++i)
+        try
+        {
+            // The new items first, the source may still point into the
+            // original array.
+            uninitialized_copy_n(first, count, gap);
+        }
+        catch (...)
         {
-            temp[i] =
-                std::move(m_list_array[i]); // Move all items of original array.
+            deallocate(temp, new_capacity);
+            throw;
         }
 
-        delete[] m_list_array; // Get rid of the original array.
-        m_list_array = temp;   // "temp" is our new array now.
+        if constexpr (std::is_trivially_copyable_v<value_type>)
+        {
+            if (pos != 0)
+            {
+                std::memcpy(temp, m_list_array, pos * sizeof(value_type));
+            }
+            if (pos != m_size)
+            {
+                std::memcpy(gap + count,
+                            m_list_array + pos,
+                            (m_size - pos) * sizeof(value_type));
+            }
+        }
+        else
+        {
+            try
+            {
+                uninitialized_move(m_list_array, m_list_array + pos, temp);
+                try
+                {
+                    uninitialized_move(m_list_array + pos,
+                                            m_list_array + m_size,
+                                            gap + count);
+                }
+                catch (...)
+                {
+                    destroy(temp, temp + pos);
+                    throw;
+                }
+            }
+            catch (...)
+            {
+                destroy(gap, gap + count);
+                deallocate(temp, new_capacity);
+                throw;
+            }
+
+            destroy(m_list_array, m_list_array + m_size);
+        }
+
+        deallocate(m_list_array, m_capacity);
+        m_list_array = temp;
+        m_capacity   = new_capacity;
+        m_size += count;
+    }
+
+    // Insert "count" items from "first" at "pos" when they fit.
+    // The tail is shifted up once by "count" slots.
+    template <typename It>
+    void shift_insert(const size_type pos, const size_type count, It first)
+    {
+        pointer   gap      = m_list_array + pos;
+        pointer   old_end  = m_list_array + m_size;
+        size_type tail_len = m_size - pos;
+
+        if constexpr (std::is_trivially_copyable_v<value_type>)
+        {
+            if (tail_len != 0)
+            {
+                std::memmove(gap + count, gap, tail_len * sizeof(value_type));
+            }
+            try
+            {
+                uninitialized_copy_n(first, count, gap);
+            }
+            catch (...)
+            {
+                // Reading "first" threw, close the gap again.
+                if (tail_len != 0)
+                {
+                    std::memmove(gap, gap + count, tail_len * sizeof(value_type));
+                }
+                throw;
+            }
+            m_size += count;
+        }
+        else if (tail_len > count)
+        {
+            /// DEMONSTRATION (count = 2)
+            // │10  │20  │30  │40  │    │    │   // ITEMS
+            // │10  │20  │30  │40  │30  │40  │   // CONSTRUCT LAST "count"
+            // │10  │20  │20  │30  │30  │40  │   // MOVE THE REST UP
+            // │10  │a   │b   │20  │30  │40  │   // ASSIGN THE NEW ITEMS
+            uninitialized_move(old_end - count, old_end, old_end);
+            m_size += count;
+            std::move_backward(gap, old_end - count, old_end);
+            std::copy_n(first, count, gap);
+        }
+        else
+        {
+            // The new items outnumber the tail, so the surplus goes straight
+            // into raw storage and the whole tail moves into raw storage.
+            It mid = std::next(first, static_cast<std::ptrdiff_t>(tail_len));
+            uninitialized_copy_n(mid, count - tail_len, old_end);
+            m_size += count - tail_len;
+            uninitialized_move(gap, old_end, gap + count);
+            m_size += tail_len;
+            std::copy_n(first, tail_len, gap);
+        }
+    }
+
+    // Insert "count" items from "first" at "pos", growing at most once.
+    template <typename It>
+    void insert_n(const size_type pos, const size_type count, It first)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if (m_size + count > m_capacity)
+        {
+            grow_insert(pos, count, first);
+        }
+        else
+        {
+            shift_insert(pos, count, first);
+        }
     }
 
 public:
     ArrayList() = default;
 
-    ArrayList(const size_type size, const_reference value = value_type{})
-        : m_capacity{size * GROWTH_FACTOR},
-          m_size{size},
-          m_list_array{new value_type[m_capacity]{value}}
-          // ArrayList elements are initialized by value.
+    explicit ArrayList(const allocator_type& allocator)
+        : m_allocator{allocator}
     {
     }
 
-    ArrayList(const std::initializer_list<value_type> i_list)
-        : ArrayList(i_list.size())
-    // Don't use braces as initializer_list constructor uses it.
-    // Otherwise this constructor would call itself.
+    ArrayList(const size_type       size,
+              const_reference       value     = value_type{},
+              const allocator_type& allocator = allocator_type{})
+        : m_capacity{size},
+          m_allocator{allocator}
     {
-        for (size_type count{}; const auto& item : i_list)
+        m_list_array = allocate(m_capacity);
+
+        try
         {
-            m_list_array[count] = std::move(item);
-            count++;
+            // ArrayList elements are initialized by value.
+            for (; m_size < size; ++m_size)
+            {
+                construct(m_list_array + m_size, value);
+            }
+        }
+        catch (...)
+        {
+            release(); // Destroys the ones built so far.
+            throw;
         }
     }
 
+    ArrayList(const std::initializer_list<value_type> i_list,
+              const allocator_type&                   allocator = allocator_type{})
+        : m_capacity{i_list.size()},
+          m_allocator{allocator}
+    {
+        m_list_array = allocate(m_capacity);
+
+        try
+        {
+            // Construct the items in place rather than assigning over
+            // default constructed ones.
+            uninitialized_copy_n(i_list.begin(), i_list.size(), m_list_array);
+        }
+        catch (...)
+        {
+            deallocate(m_list_array, m_capacity);
+            throw;
+        }
+
+        m_size = i_list.size();
+    }
+
     // Copy constructor.
     /*
      * Rule of Three:
@@ -82,15 +399,31 @@ public:
      * it almost certainly requires all three.
      */
     ArrayList(const ArrayList& other)
+        : ArrayList(other,
+                    alloc_traits::select_on_container_copy_construction(
+                        other.m_allocator))
+    {
+    }
+
+    // Copy constructor that puts the copy in the given allocator.
+    ArrayList(const ArrayList& other, const allocator_type& allocator)
         : List<value_type>{},
           m_capacity{other.m_capacity},
-          m_size{other.m_size},
-          m_list_array{new value_type[other.m_capacity]{}}
+          m_allocator{allocator}
     {
-        for (size_type i{}; i < m_size; ++i)
+        m_list_array = allocate(m_capacity);
+
+        try
         {
-            m_list_array[i] = other.m_list_array[i];
+            uninitialized_copy_n(other.m_list_array, other.m_size, m_list_array);
         }
+        catch (...)
+        {
+            deallocate(m_list_array, m_capacity);
+            throw;
+        }
+
+        m_size = other.m_size;
     }
 
     // Copy assignment operator.
@@ -98,16 +431,18 @@ public:
     {
         if (this != &other)
         {
-            delete[] m_list_array;
+            constexpr bool propagate{
+                alloc_traits::propagate_on_container_copy_assignment::value};
 
-            m_capacity   = other.m_capacity;
-            m_size       = other.m_size;
-            m_list_array = new value_type[other.m_capacity];
+            // Copy first, so a throwing copy leaves this list untouched.
+            ArrayList temp{other, propagate ? other.m_allocator : m_allocator};
 
-            for (size_type i{}; i < m_size; ++i)
+            release();
+            if constexpr (propagate)
             {
-                m_list_array[i] = other.m_list_array[i];
+                m_allocator = temp.m_allocator;
             }
+            take(temp);
         }
         return *this;
     }
@@ -129,57 +464,174 @@ public:
           // value.
           m_capacity{std::exchange(other.m_capacity, 0)},
           m_size{std::exchange(other.m_size, 0)},
-          m_list_array{std::exchange(other.m_list_array, nullptr)}
+          m_list_array{std::exchange(other.m_list_array, nullptr)},
+          m_allocator{std::move(other.m_allocator)}
     {
     }
 
+    // Move constructor that puts the elements in the given allocator.
+    // If it can't free the storage of "other", elements are moved one by one.
+    ArrayList(ArrayList&& other, const allocator_type& allocator)
+        : List<value_type>{},
+          m_allocator{allocator}
+    {
+        if (m_allocator == other.m_allocator)
+        {
+            take(other);
+            return;
+        }
+
+        m_list_array = allocate(other.m_size);
+
+        try
+        {
+            uninitialized_move(other.m_list_array,
+                               other.m_list_array + other.m_size,
+                               m_list_array);
+        }
+        catch (...)
+        {
+            deallocate(m_list_array, other.m_size);
+            throw;
+        }
+
+        m_capacity = other.m_size;
+        m_size     = other.m_size;
+        other.clear();
+    }
+
     // Move assignment operator.
-    ArrayList& operator=(ArrayList&& other) noexcept
+    // Storage can only change hands if our allocator is able to free it.
+    ArrayList& operator=(ArrayList&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value ||
+        alloc_traits::is_always_equal::value)
     {
         if (this != &other)
         {
-            delete[] m_list_array; // Clean up.
-
-            // Member-wise move and reset.
-            m_capacity   = std::exchange(other.m_capacity, 0);
-            m_size       = std::exchange(other.m_size, 0);
-            m_list_array = std::exchange(other.m_list_array, nullptr);
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::
+                              value)
+            {
+                release(); // Clean up.
+                m_allocator = std::move(other.m_allocator);
+                take(other); // Member-wise move and reset.
+            }
+            else if (m_allocator == other.m_allocator)
+            {
+                release();
+                take(other);
+            }
+            else
+            {
+                ArrayList temp{std::move(other), m_allocator};
+                release();
+                take(temp);
+            }
         }
         return *this;
     }
 
     ~ArrayList()
     {
-        delete[] m_list_array;
+        release();
         m_list_array = nullptr; // Freeing pointer doesn't make it nullptr.
     }
 
+    // Swap two lists.
+    // Allocators that don't propagate on swap must compare equal.
+    void swap(ArrayList& other) noexcept
+    {
+        if constexpr (alloc_traits::propagate_on_container_swap::value)
+        {
+            std::swap(m_allocator, other.m_allocator);
+        }
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_size, other.m_size);
+        std::swap(m_list_array, other.m_list_array);
+    }
+
+    [[nodiscard]]
+    allocator_type get_allocator() const noexcept
+    {
+        return m_allocator;
+    }
+
+    // Return the number of elements the list can hold before growing.
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Make room for at least "new_capacity" elements, so that appending up
+    // to that many doesn't reallocate. Never shrinks.
+    void reserve(const size_type new_capacity)
+    {
+        if (new_capacity > m_capacity)
+        {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Give back the unused capacity.
+    void shrink_to_fit()
+    {
+        if (m_size == m_capacity)
+        {
+            return;
+        }
+
+        if (m_size == 0)
+        {
+            clear();
+            return;
+        }
+
+        reallocate(m_size);
+    }
+
     void clear()
     {
-        delete[] m_list_array;
+        release();
         m_list_array = nullptr;
         m_capacity   = 0;
         m_size       = 0;
     }
 
-    // Insert "item" at given position.
-    void insert(const size_type pos, const_reference item) override
+    /**
+     * @brief Construct an element from "args" at given position.
+     *
+     * @return Reference to the new element.
+     */
+    template <typename... Args>
+    reference emplace(const size_type pos, Args&&... args)
     {
         if (pos > m_size)
         {
             throw std::out_of_range{"Position out of range."};
         }
 
-        if (m_size == m_capacity)
+        if (pos == m_size)
         {
-            reserve();
+            return emplace_back(std::forward<Args>(args)...);
         }
-        // assert(pos < m_size && "Out of range.\n");
 
-        for (size_type s{m_size}; pos < s; --s) // Shift elements up...
+        // "args" may refer to elements of this list, build the new element
+        // before anything moves.
+        value_type temp(std::forward<Args>(args)...);
+
+        if (m_size == m_capacity)
         {
-            m_list_array[s] = m_list_array[s - 1]; // ...to make room.
+            grow();
         }
+        // assert(pos < m_size && "Out of range.\n");
+
+        // Shift elements up to make room. The slot past the last element is
+        // raw storage, so the last element is constructed there, the rest is
+        // moved over live elements.
+        construct(m_list_array + m_size, std::move(m_list_array[m_size - 1]));
+        std::move_backward(m_list_array + pos,
+                           m_list_array + m_size - 1,
+                           m_list_array + m_size);
         /// DEMONSTRATION
         // ┌────┬────┬────┬────┬────┬────┬────┐
         // │i[0]│i[1]│i[2]│i[3]│i[4]│i[5]│i[6]│     // INDEXES
@@ -191,27 +643,134 @@ public:
         // │item│10  │20  │30  │40  │50  │60  │     // INSERT "item"
         // └────┴────┴────┴────┴────┴────┴────┘
         //
-        m_list_array[pos] = std::move(item); // Insert "item" at position "pos".
+        m_list_array[pos] = std::move(temp); // Insert "item" at position "pos".
 
         m_size++; // Increment list size.
+        return m_list_array[pos];
+    }
+
+    /**
+     * @brief Construct an element from "args" at the end of the list.
+     *
+     * @return Reference to the new element.
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (m_size != m_capacity)
+        {
+            // Construct the item in place at the end of the list.
+            construct(m_list_array + m_size, std::forward<Args>(args)...);
+            return m_list_array[m_size++];
+        }
+
+        // "args" may refer to elements of this list, so the new element is
+        // built in the new storage before the old elements move out.
+        const size_type new_capacity{Growth::grow(m_capacity, m_size + 1)};
+        pointer         temp = allocate(new_capacity);
+
+        try
+        {
+            construct(temp + m_size, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocate(temp, new_capacity);
+            throw;
+        }
+
+        try
+        {
+            relocate(temp);
+        }
+        catch (...)
+        {
+            destroy(temp + m_size, temp + m_size + 1);
+            deallocate(temp, new_capacity);
+            throw;
+        }
+
+        deallocate(m_list_array, m_capacity);
+        m_list_array = temp;
+        m_capacity   = new_capacity;
+
+        return m_list_array[m_size++];
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        emplace(pos, item);
+    }
+
+    // Insert "item" at given position, moving it into the list.
+    void insert(const size_type pos, value_type&& item)
+    {
+        emplace(pos, std::move(item));
     }
 
     // Append "item".
-    void append(const_reference item) override
+    void append(const_reference item) final
     {
-        if (m_size == m_capacity)
+        emplace_back(item);
+    }
+
+    // Append "item", moving it into the list.
+    void append(value_type&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    /**
+     * @brief Insert the items of [first, last) at given position.
+     *
+     * @details The list grows at most once and the tail is shifted once.
+     * The range must not refer to elements of this list.
+     */
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    void insert(const size_type pos, It first, S last)
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        if constexpr (std::forward_iterator<It>)
         {
-            reserve();
+            const auto count =
+                static_cast<size_type>(std::ranges::distance(first, last));
+
+            insert_n(pos, count, first);
+        }
+        else
+        {
+            // Single pass range, its length is unknown until it is consumed.
+            ArrayList buffer{m_allocator};
+            for (; first != last; ++first)
+            {
+                buffer.append(*first);
+            }
+            insert_n(pos,
+                     buffer.m_size,
+                     std::make_move_iterator(buffer.m_list_array));
         }
-        // assert(m_size < m_capacity && "List capacity exceeded.\n");
+    }
 
-        m_list_array[m_size] =
-            std::move(item); // Append "item" at the end of the list.
-        m_size++;
+    // Insert the items of "i_list" at given position.
+    void insert(const size_type pos, const std::initializer_list<value_type> i_list)
+    {
+        insert(pos, i_list.begin(), i_list.end());
+    }
+
+    // Append the items of "range".
+    template <std::ranges::input_range R>
+    void append_range(R&& range)
+    {
+        insert(m_size, std::ranges::begin(range), std::ranges::end(range));
     }
 
     // Remove and return the current element.
-    void remove(const size_type pos) override
+    void remove(const size_type pos) final
     {
         if (pos >= m_size)
         {
@@ -223,10 +782,9 @@ public:
 
         // m_size - 1, because we're dealing with array indexes (array[size] is
         // out of bounds).
-        for (size_type i{pos}; i < m_size - 1; ++i)
-        {
-            m_list_array[i] = m_list_array[i + 1]; // Shift elements down.
-        }
+        std::move(m_list_array + pos + 1,
+                  m_list_array + m_size,
+                  m_list_array + pos); // Shift elements down.
         /// DEMONSTRATION
         // ┌────┬────┬────┬────┬────┬────┬────┐
         // │i[0]│i[1]│i[2]│i[3]│i[4]│i[5]│i[6]│     // INDEXES
@@ -237,33 +795,68 @@ public:
         // └────┴────┴────┴────┴────┴────┴────┘
         //
         --m_size; // Decrement size.
+        // End the vacated slot.
+        destroy(m_list_array + m_size, m_list_array + m_size + 1);
 
         // return item;
     }
 
+    // Remove the elements in [first_pos, last_pos).
+    // The tail is shifted down once.
+    void remove(const size_type first_pos, const size_type last_pos)
+    {
+        if (first_pos > last_pos || last_pos > m_size)
+        {
+            throw std::out_of_range{"Invalid range."};
+        }
+
+        const size_type count{last_pos - first_pos};
+
+        if (count == 0)
+        {
+            return;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<value_type>)
+        {
+            std::memmove(m_list_array + first_pos,
+                         m_list_array + last_pos,
+                         (m_size - last_pos) * sizeof(value_type));
+        }
+        else
+        {
+            std::move(m_list_array + last_pos,
+                      m_list_array + m_size,
+                      m_list_array + first_pos); // Shift elements down.
+            destroy(m_list_array + m_size - count, m_list_array + m_size);
+        }
+
+        m_size -= count;
+    }
+
     // Return list size.
-    size_type size() const override
+    size_type size() const final
     {
         return m_size;
     }
 
     [[nodiscard]]
-    bool empty() const override
+    bool empty() const final
     {
         return size() == 0;
     }
 
-    reference operator[](const size_type pos) override
+    reference operator[](const size_type pos) final
     {
         return m_list_array[pos];
     }
 
-    const_reference operator[](const size_type pos) const override
+    const_reference operator[](const size_type pos) const final
     {
         return m_list_array[pos];
     }
 
-    reference at(const size_type pos) override
+    reference at(const size_type pos)
     {
         if (pos >= m_size)
         {
@@ -272,23 +865,135 @@ public:
         return m_list_array[pos];
     }
 
+    /*
+     * Searching and reductions for arithmetic types.
+     * These run the vectorized kernels in ArrayListSimd.hpp straight over the
+     * array, falling back to plain loops where no vector unit is available.
+     */
+
+    // Return iterator at the first element equal to "value", or end().
+    iterator find(const value_type value)
+        requires std::is_arithmetic_v<value_type>
+    {
+        return iterator{
+            m_list_array + arraylist_simd::find(m_list_array, m_size, value)};
+    }
+
+    const_iterator find(const value_type value) const
+        requires std::is_arithmetic_v<value_type>
+    {
+        return const_iterator{
+            m_list_array + arraylist_simd::find(m_list_array, m_size, value)};
+    }
+
+    [[nodiscard]]
+    bool contains(const value_type value) const
+        requires std::is_arithmetic_v<value_type>
+    {
+        return arraylist_simd::find(m_list_array, m_size, value) != m_size;
+    }
+
+    // Return the number of elements equal to "value".
+    [[nodiscard]]
+    size_type count(const value_type value) const
+        requires std::is_arithmetic_v<value_type>
+    {
+        return arraylist_simd::count(m_list_array, m_size, value);
+    }
+
+    // Return the smallest element.
+    [[nodiscard]]
+    value_type min() const
+        requires std::is_arithmetic_v<value_type>
+    {
+        if (m_size == 0)
+        {
+            throw std::out_of_range{"List is empty."};
+        }
+        return arraylist_simd::min(m_list_array, m_size);
+    }
+
+    // Return the greatest element.
+    [[nodiscard]]
+    value_type max() const
+        requires std::is_arithmetic_v<value_type>
+    {
+        if (m_size == 0)
+        {
+            throw std::out_of_range{"List is empty."};
+        }
+        return arraylist_simd::max(m_list_array, m_size);
+    }
+
+    // Return the sum of all elements, or 0 if the list is empty.
+    // Floating point sums are added in several partial sums.
+    [[nodiscard]]
+    value_type sum() const
+        requires std::is_arithmetic_v<value_type>
+    {
+        return arraylist_simd::sum(m_list_array, m_size);
+    }
+
+    // Return pointer to the underlying array, e.g. for std::span.
+    // [data(), data() + size()) is always a valid range.
+    pointer data() noexcept
+    {
+        return m_list_array;
+    }
+
+    const_pointer data() const noexcept
+    {
+        return m_list_array;
+    }
+
     // Return iterator at beginning of list.
-    ArrayListIterator<value_type> begin() const
+    iterator begin()
     {
         // m_list_array points to the first element.
-        return ArrayListIterator<value_type>{m_list_array};
+        return iterator{m_list_array};
     }
 
     // Return iterator past end of list.
-    ArrayListIterator<value_type> end() const
+    iterator end()
     {
         // m_list_array + m_size points to the element past the last one.
-        return ArrayListIterator<value_type>{m_list_array + m_size};
+        return iterator{m_list_array + m_size};
+    }
+
+    // Const iterators. Same as the regular iterators but read-only.
+    const_iterator begin() const
+    {
+        return const_iterator{m_list_array};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{m_list_array + m_size};
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
     }
 };
 
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const ArrayList<T>& list)
+namespace pmr
+{
+    // An ArrayList whose storage comes from a std::pmr::memory_resource,
+    // e.g. a std::pmr::monotonic_buffer_resource arena.
+    template <typename T, GrowthPolicy Growth = DoublingGrowth>
+    using ArrayList =
+        ::ArrayList<T, std::pmr::polymorphic_allocator<T>, Growth>;
+} // namespace pmr
+
+template <typename T, typename Allocator, GrowthPolicy Growth>
+std::ostream& operator<<(std::ostream&                           os,
+                         const ArrayList<T, Allocator, Growth>& list)
 {
     for (const auto& item : list)
     {
@@ -2,20 +2,29 @@
 #ifndef ARRAYLISTITERATOR_HPP
 #define ARRAYLISTITERATOR_HPP
 
-#include <cstddef>  // std::ptrdiff_t
-#include <iterator> // std::random_access_iterator_tag
+#include <compare>     // std::strong_ordering
+#include <cstddef>     // std::ptrdiff_t
+#include <iterator>    // std::random_access_iterator_tag, std::contiguous_iterator_tag
+#include <type_traits> // std::remove_cv_t, std::is_const_v
 
 // This class is used in order to be compliant with the STL algorithms.
+// It models std::contiguous_iterator, so the standard algorithms and
+// std::span see straight through it to the underlying pointer.
+// ArrayListIterator<const T> is the const_iterator.
 template <typename T>
 class ArrayListIterator
 {
 public:
     // std::random_access_iterator_tag since we're using array, which is a random access container.
     using iterator_category = std::random_access_iterator_tag;
-    using difference_type   = std::ptrdiff_t;
-    using value_type        = T;
-    using pointer           = value_type*;
-    using reference         = value_type&;
+    // The elements are also adjacent in memory, which the C++20 algorithms
+    // use to fall back to memmove and friends.
+    using iterator_concept = std::contiguous_iterator_tag;
+    using difference_type  = std::ptrdiff_t;
+    using value_type       = std::remove_cv_t<T>;
+    using element_type     = T;
+    using pointer          = T*;
+    using reference        = T&;
 
     // Default constructor.
     ArrayListIterator() = default;
@@ -26,6 +35,14 @@ public:
     {
     }
 
+    // An iterator converts to a const_iterator, but not the other way.
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    ArrayListIterator(const ArrayListIterator<U>& other)
+        : m_ptr{other.operator->()}
+    {
+    }
+
     // To move one position forward. (Pre-increment)
     ArrayListIterator& operator++()
     {
@@ -41,7 +58,7 @@ public:
     }
 
     // To move one position forward. (Post-increment)
-    ArrayListIterator& operator++(int)
+    ArrayListIterator operator++(int)
     {
         ArrayListIterator temp{*this}; // Save the current iterator position.
         ++m_ptr;
@@ -49,7 +66,7 @@ public:
     }
 
     // To move one position backward. (Post-decrement)
-    ArrayListIterator& operator--(int)
+    ArrayListIterator operator--(int)
     {
         ArrayListIterator temp{*this}; // Save the current iterator position.
         --m_ptr;
@@ -63,7 +80,7 @@ public:
     }
 
     // To point at the current iterator position.
-    pointer operator->()
+    pointer operator->() const
     {
         return m_ptr;
     }
@@ -74,18 +91,23 @@ public:
         return it1.m_ptr == it2.m_ptr;
     }
 
-    // To compare iterators for inequality.
-    friend bool operator!=(const ArrayListIterator& it1, const ArrayListIterator& it2)
+    // To move the iterator forward by a certain amount.
+    friend ArrayListIterator operator+(const ArrayListIterator& it, difference_type n)
     {
-        return !(it1 == it2);
+        return ArrayListIterator{it.m_ptr + n};
     }
 
-    // To move the iterator forward by a certain amount.
-    friend ArrayListIterator operator+(const ArrayListIterator& it, difference_type n)
+    friend ArrayListIterator operator+(difference_type n, const ArrayListIterator& it)
     {
         return ArrayListIterator{it.m_ptr + n};
     }
 
+    // To move the iterator backward by a certain amount.
+    friend ArrayListIterator operator-(const ArrayListIterator& it, difference_type n)
+    {
+        return ArrayListIterator{it.m_ptr - n};
+    }
+
     // To get the distance between two iterators.
     friend difference_type operator-(const ArrayListIterator& it1, const ArrayListIterator& it2)
     {
@@ -107,30 +129,15 @@ public:
     }
 
     // To get the value at a certain position.
-    reference operator[](difference_type n)
+    reference operator[](difference_type n) const
     {
         return *(m_ptr + n);
     }
 
-    // Comparing the iterators.
-    friend bool operator<(const ArrayListIterator& it1, const ArrayListIterator& it2)
-    {
-        return it1.m_ptr < it2.m_ptr;
-    }
-
-    friend bool operator>(const ArrayListIterator& it1, const ArrayListIterator& it2)
-    {
-        return operator<(it2, it1); // Return the negated value of operator<.
-    }
-
-    friend bool operator<=(const ArrayListIterator& it1, const ArrayListIterator& it2)
-    {
-        return !(operator>(it1, it2)); // Return the negated value of operator>.
-    }
-
-    friend bool operator>=(const ArrayListIterator& it1, const ArrayListIterator& it2)
+    // Comparing the iterators. <, >, <= and >= are derived from it.
+    friend std::strong_ordering operator<=>(const ArrayListIterator& it1, const ArrayListIterator& it2)
     {
-        return !(operator<(it1, it2)); // Return the negated value of operator<.
+        return it1.m_ptr <=> it2.m_ptr;
     }
 
 private:
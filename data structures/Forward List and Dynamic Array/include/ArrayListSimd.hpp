@@ -0,0 +1,395 @@
+// Vectorized search and reduction kernels used by ArrayList.
+// The kernels are written with GCC/Clang vector extensions and compiled for
+// AVX2 and SSE2 on x86, the best one is picked at runtime. Other compilers
+// and element types take the scalar loops.
+#ifndef ARRAYLISTSIMD_HPP
+#define ARRAYLISTSIMD_HPP
+
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::uint64_t
+#include <cstring>     // std::memcpy
+#include <type_traits> // std::is_arithmetic_v, std::is_same_v
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARRAYLIST_SIMD_X86 1
+#endif
+
+#if defined(__GNUC__)
+#define ARRAYLIST_SIMD_VECTOR 1
+#endif
+
+namespace arraylist_simd
+{
+    // Element types the vector kernels handle: 32 and 64 bit integers and
+    // floating point numbers. Everything else goes through the scalar loops.
+    template <typename T>
+    concept Vectorizable = std::is_arithmetic_v<T> &&
+                           !std::is_same_v<T, bool> &&
+                           (sizeof(T) == 4 || sizeof(T) == 8);
+
+    /**
+     * @brief Plain loops, the fallback for every kernel.
+     *
+     * @details min and max only replace the current best with a strictly
+     * smaller (or greater) item. A NaN compares false both ways, so it is
+     * the result if it is the first item and skipped anywhere else. The
+     * vector kernels give the same result, except that of two equal zeros
+     * either sign may come back.
+     */
+    template <typename T>
+    struct Scalar
+    {
+        static std::size_t find(const T* data, const std::size_t size, const T value)
+        {
+            for (std::size_t i{}; i < size; ++i)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return size;
+        }
+
+        static std::size_t count(const T* data, const std::size_t size, const T value)
+        {
+            std::size_t total{};
+            for (std::size_t i{}; i < size; ++i)
+            {
+                total += static_cast<std::size_t>(data[i] == value);
+            }
+            return total;
+        }
+
+        // "size" must be at least 1.
+        static T min(const T* data, const std::size_t size)
+        {
+            T best{data[0]};
+            for (std::size_t i{1}; i < size; ++i)
+            {
+                best = data[i] < best ? data[i] : best;
+            }
+            return best;
+        }
+
+        // "size" must be at least 1.
+        static T max(const T* data, const std::size_t size)
+        {
+            T best{data[0]};
+            for (std::size_t i{1}; i < size; ++i)
+            {
+                best = best < data[i] ? data[i] : best;
+            }
+            return best;
+        }
+
+        static T sum(const T* data, const std::size_t size)
+        {
+            T total{};
+            for (std::size_t i{}; i < size; ++i)
+            {
+                total += data[i];
+            }
+            return total;
+        }
+    };
+
+#ifdef ARRAYLIST_SIMD_VECTOR
+    /**
+     * @brief The kernels on "Bytes" wide vectors.
+     *
+     * @details These carry no target attribute themselves. They are flattened
+     * into the per-ISA entry points below, which decide the instructions.
+     * Leftover items that don't fill a vector go through Scalar.
+     */
+    template <Vectorizable T, std::size_t Bytes>
+    struct Vector
+    {
+        static constexpr std::size_t lanes{Bytes / sizeof(T)};
+
+        typedef T vec __attribute__((vector_size(Bytes)));
+        // Comparisons give a vector of same width integers, all ones for true.
+        using mask = decltype(vec{} == vec{});
+
+        // Vectors are passed by reference, returning them by value from a
+        // function that isn't compiled for AVX would change the ABI.
+        static void load(vec& chunk, const T* data)
+        {
+            std::memcpy(&chunk, data, sizeof(chunk)); // Unaligned load.
+        }
+
+        static bool any(const mask& bits)
+        {
+            std::uint64_t words[Bytes / sizeof(std::uint64_t)];
+            std::memcpy(words, &bits, sizeof(words));
+
+            std::uint64_t merged{};
+            for (const auto word : words)
+            {
+                merged |= word;
+            }
+            return merged != 0;
+        }
+
+        static std::size_t find(const T* data, const std::size_t size, const T value)
+        {
+            const vec needle = vec{} + value; // "value" in every lane.
+            vec       chunk;
+
+            std::size_t i{};
+            // Skip whole vectors without a match, the scalar loop pins it down.
+            for (; i + lanes <= size; i += lanes)
+            {
+                load(chunk, data + i);
+                if (any(chunk == needle))
+                {
+                    break;
+                }
+            }
+            return i + Scalar<T>::find(data + i, size - i, value);
+        }
+
+        static std::size_t count(const T* data, const std::size_t size, const T value)
+        {
+            // Lane counters are flushed every block so they can't overflow.
+            constexpr std::size_t block{lanes << 16};
+
+            const vec   needle = vec{} + value;
+            vec         chunk;
+            std::size_t total{};
+            std::size_t i{};
+
+            while (i + lanes <= size)
+            {
+                const std::size_t stop{
+                    size - i < block ? i + (size - i) / lanes * lanes : i + block};
+
+                mask hits{};
+                for (; i < stop; i += lanes)
+                {
+                    load(chunk, data + i);
+                    hits -= (chunk == needle); // A match is -1.
+                }
+
+                for (std::size_t lane{}; lane < lanes; ++lane)
+                {
+                    total += static_cast<std::size_t>(hits[lane]);
+                }
+            }
+            return total + Scalar<T>::count(data + i, size - i, value);
+        }
+
+        // "size" must be at least 1.
+        static T min(const T* data, const std::size_t size)
+        {
+            if (size < lanes)
+            {
+                return Scalar<T>::min(data, size);
+            }
+
+            // Every lane starts from the first item, as the scalar loop
+            // does. Starting from the first vector would let a NaN in it
+            // stick in its lane and hide the items that follow there.
+            vec best = vec{} + data[0];
+            vec chunk;
+
+            std::size_t i{};
+            for (; i + lanes <= size; i += lanes)
+            {
+                load(chunk, data + i);
+                best = chunk < best ? chunk : best;
+            }
+
+            T result{best[0]};
+            for (std::size_t lane{1}; lane < lanes; ++lane)
+            {
+                result = best[lane] < result ? best[lane] : result;
+            }
+            for (; i < size; ++i)
+            {
+                result = data[i] < result ? data[i] : result;
+            }
+            return result;
+        }
+
+        // "size" must be at least 1.
+        static T max(const T* data, const std::size_t size)
+        {
+            if (size < lanes)
+            {
+                return Scalar<T>::max(data, size);
+            }
+
+            // Every lane starts from the first item, as the scalar loop
+            // does. Starting from the first vector would let a NaN in it
+            // stick in its lane and hide the items that follow there.
+            vec best = vec{} + data[0];
+            vec chunk;
+
+            std::size_t i{};
+            for (; i + lanes <= size; i += lanes)
+            {
+                load(chunk, data + i);
+                best = best < chunk ? chunk : best;
+            }
+
+            T result{best[0]};
+            for (std::size_t lane{1}; lane < lanes; ++lane)
+            {
+                result = result < best[lane] ? best[lane] : result;
+            }
+            for (; i < size; ++i)
+            {
+                result = result < data[i] ? data[i] : result;
+            }
+            return result;
+        }
+
+        // Floating point sums are added in "lanes" partial sums, so the
+        // result may differ from the scalar loop in the last bits.
+        static T sum(const T* data, const std::size_t size)
+        {
+            vec partial{};
+            vec chunk;
+
+            std::size_t i{};
+            for (; i + lanes <= size; i += lanes)
+            {
+                load(chunk, data + i);
+                partial += chunk;
+            }
+
+            T total{};
+            for (std::size_t lane{}; lane < lanes; ++lane)
+            {
+                total += partial[lane];
+            }
+            return total + Scalar<T>::sum(data + i, size - i);
+        }
+    };
+#endif // ARRAYLIST_SIMD_VECTOR
+
+#ifdef ARRAYLIST_SIMD_X86
+// Entry points compiled for one instruction set. Everything they call is
+// inlined into them, so the kernels are generated with that instruction set.
+#define ARRAYLIST_SIMD_ENTRY(isa, bytes)                                       \
+    template <Vectorizable T>                                                  \
+    struct isa##_kernels                                                       \
+    {                                                                          \
+        using kernel = Vector<T, bytes>;                                       \
+                                                                               \
+        [[gnu::target(#isa), gnu::flatten]]                                    \
+        static std::size_t find(const T* data, std::size_t size, T value)      \
+        {                                                                      \
+            return kernel::find(data, size, value);                            \
+        }                                                                      \
+                                                                               \
+        [[gnu::target(#isa), gnu::flatten]]                                    \
+        static std::size_t count(const T* data, std::size_t size, T value)     \
+        {                                                                      \
+            return kernel::count(data, size, value);                           \
+        }                                                                      \
+                                                                               \
+        [[gnu::target(#isa), gnu::flatten]]                                    \
+        static T min(const T* data, std::size_t size)                          \
+        {                                                                      \
+            return kernel::min(data, size);                                    \
+        }                                                                      \
+                                                                               \
+        [[gnu::target(#isa), gnu::flatten]]                                    \
+        static T max(const T* data, std::size_t size)                          \
+        {                                                                      \
+            return kernel::max(data, size);                                    \
+        }                                                                      \
+                                                                               \
+        [[gnu::target(#isa), gnu::flatten]]                                    \
+        static T sum(const T* data, std::size_t size)                          \
+        {                                                                      \
+            return kernel::sum(data, size);                                    \
+        }                                                                      \
+    };
+
+    ARRAYLIST_SIMD_ENTRY(avx2, 32)
+    ARRAYLIST_SIMD_ENTRY(sse2, 16)
+
+#undef ARRAYLIST_SIMD_ENTRY
+
+    // Checked once, the answer doesn't change while the program runs.
+    inline bool has_avx2()
+    {
+        static const bool supported{__builtin_cpu_supports("avx2") != 0};
+        return supported;
+    }
+
+    inline bool has_sse2()
+    {
+        static const bool supported{__builtin_cpu_supports("sse2") != 0};
+        return supported;
+    }
+#endif // ARRAYLIST_SIMD_X86
+
+// Forward the call to the best kernel for T on this machine.
+#if defined(ARRAYLIST_SIMD_X86)
+#define ARRAYLIST_SIMD_DISPATCH(op, ...)                                       \
+    if constexpr (Vectorizable<T>)                                             \
+    {                                                                          \
+        if (has_avx2())                                                        \
+        {                                                                      \
+            return avx2_kernels<T>::op(__VA_ARGS__);                           \
+        }                                                                      \
+        if (has_sse2())                                                        \
+        {                                                                      \
+            return sse2_kernels<T>::op(__VA_ARGS__);                           \
+        }                                                                      \
+    }                                                                          \
+    return Scalar<T>::op(__VA_ARGS__)
+#elif defined(ARRAYLIST_SIMD_VECTOR)
+#define ARRAYLIST_SIMD_DISPATCH(op, ...)                                       \
+    if constexpr (Vectorizable<T>)                                             \
+    {                                                                          \
+        return Vector<T, 16>::op(__VA_ARGS__);                                 \
+    }                                                                          \
+    return Scalar<T>::op(__VA_ARGS__)
+#else
+#define ARRAYLIST_SIMD_DISPATCH(op, ...) return Scalar<T>::op(__VA_ARGS__)
+#endif
+
+    // Index of the first item equal to "value", or "size" if there is none.
+    template <typename T>
+    std::size_t find(const T* data, const std::size_t size, const T value)
+    {
+        ARRAYLIST_SIMD_DISPATCH(find, data, size, value);
+    }
+
+    // Number of items equal to "value".
+    template <typename T>
+    std::size_t count(const T* data, const std::size_t size, const T value)
+    {
+        ARRAYLIST_SIMD_DISPATCH(count, data, size, value);
+    }
+
+    // Smallest item. "size" must be at least 1.
+    template <typename T>
+    T min(const T* data, const std::size_t size)
+    {
+        ARRAYLIST_SIMD_DISPATCH(min, data, size);
+    }
+
+    // Greatest item. "size" must be at least 1.
+    template <typename T>
+    T max(const T* data, const std::size_t size)
+    {
+        ARRAYLIST_SIMD_DISPATCH(max, data, size);
+    }
+
+    // Sum of all items.
+    template <typename T>
+    T sum(const T* data, const std::size_t size)
+    {
+        ARRAYLIST_SIMD_DISPATCH(sum, data, size);
+    }
+
+#undef ARRAYLIST_SIMD_DISPATCH
+} // namespace arraylist_simd
+
+#endif // ARRAYLISTSIMD_HPP
@@ -0,0 +1,225 @@
+// A singly linked list that many threads can append to at once.
+#ifndef CONCURRENTFORWARDLIST_HPP
+#define CONCURRENTFORWARDLIST_HPP
+
+#include "ConcurrentForwardListIterator.hpp"
+#include "ConcurrentNode.hpp"
+
+#include <atomic>   // std::atomic
+#include <cstddef>  // std::size_t
+#include <iostream> // operator<<
+#include <utility>  // std::move, std::forward, std::exchange
+
+// Keeps the contended tail off the cache line of the rest of the list.
+constexpr std::size_t CONCURRENT_CACHE_LINE{64};
+
+/**
+ * @brief An append-only singly linked list without locks, drained by a
+ * single consumer.
+ *
+ * @details A producer swaps its node in as the new tail with an atomic
+ * exchange, then links the old tail to it with a store. That exchange on the
+ * tail's cache line is the only contended write, no producer waits for
+ * another whatever the contention.
+ *
+ * Readers walk from the first item with acquire loads and see every node
+ * that is linked, in append order per producer. Between the exchange and the
+ * link a node is not reachable yet; a reader running into such a gap ends its
+ * walk early, and sees the rest on its next walk.
+ *
+ * One consumer thread at a time may take items out with try_pop() or
+ * drain() while producers keep appending. The last node taken stays behind
+ * as the link producers append to, so no producer ever writes to a freed
+ * node. Taking items frees nodes, so iterating must not overlap with it.
+ *
+ * clear() and the destructor need every producer and reader to be done.
+ *
+ * @tparam T The type of the items in the list.
+ */
+template <typename T>
+class ConcurrentForwardList
+{
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using const_reference = const value_type&;
+    using const_iterator  = ConcurrentForwardListIterator<value_type>;
+
+private:
+    using node_type = ConcurrentNode<value_type>;
+
+    // Comes before the first node and holds no item, so producers never
+    // have to touch a head pointer.
+    ConcurrentLink m_head{};
+
+    // Link before the first item not taken yet: m_head, or the node the
+    // consumer took last. Only the consumer changes it.
+    ConcurrentLink* m_first{&m_head};
+
+    // Last node appended, possibly not linked yet.
+    alignas(CONCURRENT_CACHE_LINE) std::atomic<ConcurrentLink*> m_tail{&m_head};
+
+    void link(node_type* node) noexcept
+    {
+        // acq_rel: the previous tail's producer has created it, and the next
+        // producer will write to our node's link.
+        ConcurrentLink* prev = m_tail.exchange(node, std::memory_order_acq_rel);
+
+        // Release publishes the item to readers and the consumer.
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Step m_first to the next linked node, if there is one, and return it.
+    // The node stepped off is freed, it is no producer's tail any more.
+    node_type* advance() noexcept
+    {
+        ConcurrentLink* next = m_first->next.load(std::memory_order_acquire);
+        if (next == nullptr)
+        {
+            return nullptr;
+        }
+
+        if (m_first != &m_head)
+        {
+            delete static_cast<node_type*>(m_first);
+        }
+        m_first = next;
+
+        return static_cast<node_type*>(next);
+    }
+
+public:
+    // Default constructor.
+    ConcurrentForwardList() = default;
+
+    // m_tail may point at m_head, the list can't change address.
+    ConcurrentForwardList(const ConcurrentForwardList&)            = delete;
+    ConcurrentForwardList& operator=(const ConcurrentForwardList&) = delete;
+
+    // Destructor.
+    ~ConcurrentForwardList()
+    {
+        clear();
+    }
+
+    // Construct an item from "args" at the end. Safe from any thread.
+    template <typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        link(new node_type(std::forward<Args>(args)...));
+    }
+
+    // Append "item". Safe from any thread.
+    void append(const_reference item)
+    {
+        emplace_back(item);
+    }
+
+    void append(value_type&& item)
+    {
+        emplace_back(std::move(item));
+    }
+
+    /**
+     * @brief Move the first item into "out". Return false if there is no
+     * linked item.
+     *
+     * @details Only one thread may take items at a time, producers may keep
+     * appending meanwhile.
+     */
+    bool try_pop(value_type& out)
+    {
+        node_type* node = advance();
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        out = std::move(node->data);
+        return true;
+    }
+
+    /**
+     * @brief Hand every linked item to "consume" in order, moving it out.
+     * Return the number of items taken.
+     *
+     * @details Same contract as try_pop(). Items appended during the drain
+     * are taken too once they are linked.
+     */
+    template <typename Consumer>
+    size_type drain(Consumer&& consume)
+    {
+        size_type taken{};
+        for (node_type* node = advance(); node != nullptr; node = advance())
+        {
+            consume(std::move(node->data));
+            ++taken;
+        }
+        return taken;
+    }
+
+    // Delete every node. No other thread may use the list meanwhile.
+    void clear() noexcept
+    {
+        ConcurrentLink* node = m_first->next.load(std::memory_order_acquire);
+
+        if (m_first != &m_head)
+        {
+            delete static_cast<node_type*>(m_first);
+        }
+
+        while (node != nullptr)
+        {
+            delete static_cast<node_type*>(
+                std::exchange(node, node->next.load(std::memory_order_relaxed)));
+        }
+
+        m_head.next.store(nullptr, std::memory_order_relaxed);
+        m_first = &m_head;
+        m_tail.store(&m_head, std::memory_order_relaxed);
+    }
+
+    // Number of linked items not taken yet. Walks the list, so O(n), and
+    // may lag behind appends in progress.
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        size_type count{};
+        for (auto it = begin(); it != end(); ++it)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_first->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+    // Iterator pointing at beginning. Safe while others append.
+    const_iterator begin() const
+    {
+        return const_iterator{m_first->next.load(std::memory_order_acquire)};
+    }
+
+    // Iterator pointing one past the end.
+    const_iterator end() const
+    {
+        return const_iterator{nullptr};
+    }
+};
+
+// Print the list.
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const ConcurrentForwardList<T>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+
+    return os;
+}
+#endif // CONCURRENTFORWARDLIST_HPP
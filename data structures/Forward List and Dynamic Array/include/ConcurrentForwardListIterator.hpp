@@ -0,0 +1,73 @@
+// This is an iterator class for convenient use of STL algorithms.
+#ifndef CONCURRENTFORWARDLISTITERATOR_HPP
+#define CONCURRENTFORWARDLISTITERATOR_HPP
+
+#include "ConcurrentNode.hpp"
+
+#include <atomic>   // std::memory_order_acquire
+#include <cstddef>  // std::ptrdiff_t
+#include <iterator> // std::forward_iterator_tag
+
+// This class is used in order to be compliant with the STL algorithms.
+// Each step is a single acquire load, so readers never wait for writers.
+// The items are read-only, they may be read by other threads at any time.
+template <typename T>
+class ConcurrentForwardListIterator
+{
+public:
+    // std::forward_iterator_tag since we can only move forward in a singly linked list.
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = T;
+    using pointer           = const T*;
+    using reference         = const T&;
+
+    // Default constructor.
+    ConcurrentForwardListIterator() = default;
+
+    // Constructor with pointer.
+    explicit ConcurrentForwardListIterator(const ConcurrentLink* ptr)
+        : m_ptr{ptr}
+    {
+    }
+
+    // Access the data directly at the current iterator position.
+    reference operator*() const
+    {
+        return static_cast<const ConcurrentNode<T>*>(m_ptr)->data;
+    }
+
+    // To point at the current iterator position.
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    // To move one position forward. (Pre-increment)
+    // Acquire pairs with the release that linked the next node, so its item
+    // is fully constructed.
+    ConcurrentForwardListIterator& operator++()
+    {
+        m_ptr = m_ptr->next.load(std::memory_order_acquire);
+        return *this;
+    }
+
+    // To move one position forward. (Post-increment)
+    ConcurrentForwardListIterator operator++(int)
+    {
+        ConcurrentForwardListIterator tmp = *this; // Save the current iterator position.
+        ++(*this);
+        return tmp;
+    }
+
+    // To compare iterators for equality.
+    friend bool operator==(const ConcurrentForwardListIterator& it1,
+                           const ConcurrentForwardListIterator& it2)
+    {
+        return it1.m_ptr == it2.m_ptr;
+    }
+
+private:
+    const ConcurrentLink* m_ptr{nullptr};
+};
+#endif // CONCURRENTFORWARDLISTITERATOR_HPP
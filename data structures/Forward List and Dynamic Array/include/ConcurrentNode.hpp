@@ -0,0 +1,24 @@
+#ifndef CONCURRENTNODE_HPP
+#define CONCURRENTNODE_HPP
+
+#include <atomic>  // std::atomic
+#include <utility> // std::forward
+
+// The link part of a ConcurrentNode. The list's head is a bare link.
+struct ConcurrentLink
+{
+    std::atomic<ConcurrentLink*> next{nullptr}; // Pointer to the next node.
+};
+
+template <typename T>
+struct ConcurrentNode : ConcurrentLink
+{
+    T data; // Value of the node.
+
+    template <typename... Args>
+    explicit ConcurrentNode(Args&&... args)
+        : data(std::forward<Args>(args)...)
+    {
+    }
+};
+#endif // CONCURRENTNODE_HPP
@@ -0,0 +1,328 @@
+// An array-based list whose copies share their items until one is changed.
+#ifndef COWARRAYLIST_HPP
+#define COWARRAYLIST_HPP
+
+#include "ArrayList.hpp"
+#include "List.hpp"
+
+#include <atomic>           // std::atomic
+#include <cstddef>          // std::size_t
+#include <functional>       // std::less_equal, std::less
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <stdexcept>        // std::out_of_range
+#include <utility>          // std::exchange, std::swap
+
+/**
+ * @brief A list that copies its items only when they are about to change.
+ *
+ * @details Copies share one buffer with a reference count, so copying is
+ * O(1) however long the list is. The first change through a non-const member
+ * of a shared list gives it a private copy of the buffer, later changes go
+ * straight to it. The count is atomic, so copies can be handed to other
+ * threads and read there while the original keeps changing.
+ *
+ * A reference or iterator handed out by a non-const operator[], at(),
+ * begin() or end() could write into the buffer, so the buffer stops being
+ * shareable: the next copy gets items of its own instead of sharing them.
+ * The next change of the list invalidates such references, as it does for an
+ * ArrayList, and makes the buffer shareable again.
+ *
+ * @tparam T The type of the items in the list.
+ */
+template <typename T>
+class CowArrayList : public List<T>
+{
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = typename ArrayList<value_type>::iterator;
+    using const_iterator  = typename ArrayList<value_type>::const_iterator;
+
+private:
+    struct Buffer
+    {
+        std::atomic<size_type> refs{1};          // Number of lists sharing it.
+        ArrayList<value_type>  items;
+        bool                   unshareable{false}; // A mutable reference into it is out.
+    };
+
+    // Shared items. nullptr for an empty list that never had a buffer.
+    Buffer* m_buffer{nullptr};
+
+    // Drop this list's share of the buffer.
+    void release() noexcept
+    {
+        // acq_rel: the last owner must see every write of the others before
+        // destroying the items.
+        if (m_buffer != nullptr &&
+            m_buffer->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete m_buffer;
+        }
+        m_buffer = nullptr;
+    }
+
+    // Make sure this list owns its buffer alone, copying it if it's shared.
+    ArrayList<value_type>& detach()
+    {
+        if (m_buffer == nullptr)
+        {
+            m_buffer = new Buffer{};
+        }
+        else if (m_buffer->refs.load(std::memory_order_acquire) != 1)
+        {
+            auto* copy = new Buffer{1, ArrayList<value_type>{m_buffer->items}};
+            release();
+            m_buffer = copy;
+        }
+        m_buffer->unshareable = false; // Old references are invalidated now.
+        return m_buffer->items;
+    }
+
+    // Detach for handing out a mutable reference or iterator, which keeps
+    // later copies from sharing the buffer.
+    ArrayList<value_type>& leak()
+    {
+        ArrayList<value_type>& items = detach();
+        m_buffer->unshareable        = true;
+        return items;
+    }
+
+    // Whether "item" is one of the items in the buffer.
+    bool holds(const_reference item) const noexcept
+    {
+        if (m_buffer == nullptr)
+        {
+            return false;
+        }
+
+        const value_type* first = m_buffer->items.data();
+        return std::less_equal<const value_type*>{}(first, &item) &&
+               std::less<const value_type*>{}(&item, first + m_buffer->items.size());
+    }
+
+public:
+    // Default constructor.
+    CowArrayList() = default;
+
+    // Constructor with initializer list.
+    CowArrayList(std::initializer_list<value_type> i_list)
+        : m_buffer{new Buffer{1, ArrayList<value_type>(i_list)}}
+    {
+    }
+
+    // Copy constructor. Shares the buffer of "other" unless a mutable
+    // reference into it is out, then copies the items.
+    CowArrayList(const CowArrayList& other)
+        : List<value_type>{}, m_buffer{other.m_buffer}
+    {
+        if (m_buffer != nullptr && m_buffer->unshareable)
+        {
+            m_buffer = new Buffer{1, ArrayList<value_type>{other.m_buffer->items}};
+        }
+        else if (m_buffer != nullptr)
+        {
+            // Relaxed: "other" keeps the buffer alive during the increment.
+            m_buffer->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Move constructor.
+    CowArrayList(CowArrayList&& other) noexcept
+        : List<value_type>{}, m_buffer{std::exchange(other.m_buffer, nullptr)}
+    {
+    }
+
+    // Copy and move assignment operator.
+    CowArrayList& operator=(CowArrayList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor.
+    ~CowArrayList()
+    {
+        release();
+    }
+
+    void swap(CowArrayList& other) noexcept
+    {
+        std::swap(m_buffer, other.m_buffer);
+    }
+
+    // Number of lists sharing the items of this one, itself included.
+    [[nodiscard]]
+    size_type use_count() const noexcept
+    {
+        return m_buffer == nullptr ? 0 : m_buffer->refs.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]]
+    bool is_shared() const noexcept
+    {
+        return use_count() > 1;
+    }
+
+    // Make room for at least "new_capacity" elements.
+    void reserve(const size_type new_capacity)
+    {
+        detach().reserve(new_capacity);
+    }
+
+    // Empty the list. A shared buffer is left to the other lists.
+    void clear()
+    {
+        if (is_shared())
+        {
+            release();
+        }
+        else if (m_buffer != nullptr)
+        {
+            m_buffer->items.clear();
+            m_buffer->unshareable = false;
+        }
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        if (is_shared() && holds(item))
+        {
+            // "item" lives in the shared buffer, which detach() lets go of.
+            value_type temp{item};
+            detach().insert(pos, std::move(temp));
+        }
+        else
+        {
+            // An unshared buffer handles items of its own.
+            detach().insert(pos, item);
+        }
+    }
+
+    // Insert "item" at given position, moving it into the list.
+    void insert(const size_type pos, value_type&& item)
+    {
+        if (pos > size())
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+        detach().insert(pos, std::move(item));
+    }
+
+    // Append "item".
+    void append(const_reference item) final
+    {
+        insert(size(), item);
+    }
+
+    // Append "item", moving it into the list.
+    void append(value_type&& item)
+    {
+        insert(size(), std::move(item));
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+        detach().remove(pos);
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_buffer == nullptr ? 0 : m_buffer->items.size();
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return size() == 0;
+    }
+
+    // Unshares the list, since the result may be written to.
+    reference operator[](const size_type pos) final
+    {
+        return leak()[pos];
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        return m_buffer->items[pos];
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(const size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Unshares the list, since the items may be written through the result.
+    iterator begin()
+    {
+        return leak().begin();
+    }
+
+    iterator end()
+    {
+        return leak().end();
+    }
+
+    const_iterator begin() const
+    {
+        return m_buffer == nullptr ? const_iterator{} : m_buffer->items.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_buffer == nullptr ? const_iterator{} : m_buffer->items.end();
+    }
+
+    // Iterate without unsharing.
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+};
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const CowArrayList<T>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // COWARRAYLIST_HPP
@@ -0,0 +1,318 @@
+// A sorted sequence of unsigned integers stored as varint-coded gaps.
+#ifndef DELTAARRAYLIST_HPP
+#define DELTAARRAYLIST_HPP
+
+#include "ArrayList.hpp"
+
+#include <concepts>  // std::unsigned_integral
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdint>   // std::uint8_t, std::uint64_t
+#include <iostream>  // operator<<
+#include <iterator>  // std::input_iterator_tag, std::forward_iterator_tag
+#include <stdexcept> // std::out_of_range, std::invalid_argument
+
+// Number of items coded against the same skip entry.
+constexpr std::size_t DELTA_BLOCK_SIZE{128};
+
+/**
+ * @brief A non-decreasing list of unsigned integers, compressed.
+ *
+ * @details Items are split into blocks of BlockSize. The first item of a
+ * block is kept whole in a skip index, the others as the gap to the item
+ * before them, coded in 7-bit groups (LEB128). Gaps of sorted ids or
+ * timestamps are small, so most take a byte or two.
+ *
+ * Walking the items is a sequential decode. Reaching item i starts at the
+ * skip entry of its block and decodes at most BlockSize - 1 gaps, and a
+ * search first binary searches the skip index, then scans a single block.
+ *
+ * Items can only be appended, and never below the last one.
+ *
+ * @tparam T The unsigned integer type handed in and out.
+ * @tparam BlockSize Number of items per skip entry.
+ */
+template <std::unsigned_integral T = std::uint64_t,
+          std::size_t BlockSize    = DELTA_BLOCK_SIZE>
+class DeltaArrayList
+{
+    static_assert(BlockSize > 0, "Blocks can't be empty.");
+
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+private:
+    struct SkipEntry
+    {
+        value_type first;  // First item of the block.
+        size_type  offset; // Where the gaps of the block start in m_bytes.
+    };
+
+    ArrayList<std::uint8_t> m_bytes; // Gaps, 7 bits per byte.
+    ArrayList<SkipEntry>    m_skips; // One entry per block.
+    size_type               m_size{}; // Current number of list elements.
+    value_type              m_last{}; // Last item, the next gap is from it.
+
+    // Append "gap" 7 bits at a time. The high bit says more bytes follow.
+    void encode(std::uint64_t gap)
+    {
+        while (gap >= 0x80)
+        {
+            m_bytes.append(static_cast<std::uint8_t>(gap | 0x80));
+            gap >>= 7;
+        }
+        m_bytes.append(static_cast<std::uint8_t>(gap));
+    }
+
+    // Read the gap at "offset" and move "offset" past it.
+    static value_type decode(const std::uint8_t* bytes, size_type& offset) noexcept
+    {
+        std::uint64_t gap{};
+        unsigned      shift{};
+        std::uint8_t  byte{};
+
+        do
+        {
+            byte = bytes[offset++];
+            gap |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+            shift += 7;
+        } while ((byte & 0x80) != 0);
+
+        return static_cast<value_type>(gap);
+    }
+
+public:
+    // Iterator that decodes the gaps as it goes. Items are read-only.
+    class const_iterator
+    {
+    public:
+        // A legacy forward iterator must return a real reference, so it is
+        // only an input iterator there. C++20 algorithms see it as forward.
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using reference         = T; // Items are decoded, not referenced.
+
+        const_iterator() = default;
+
+        // The iterator at "index", with "value" and "offset" already decoded.
+        const_iterator(const DeltaArrayList* list,
+                       const size_type       index,
+                       const size_type       offset,
+                       const value_type      value)
+            : m_list{list}, m_index{index}, m_offset{offset}, m_value{value}
+        {
+        }
+
+        reference operator*() const
+        {
+            return m_value;
+        }
+
+        const_iterator& operator++()
+        {
+            ++m_index;
+
+            if (m_index == m_list->m_size)
+            {
+                return *this; // Past the end, nothing to decode.
+            }
+
+            if (m_index % BlockSize == 0)
+            {
+                const SkipEntry& skip = m_list->m_skips[m_index / BlockSize];
+                m_value               = skip.first;
+                m_offset              = skip.offset;
+            }
+            else
+            {
+                m_value += decode(m_list->m_bytes.data(), m_offset);
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator temp{*this};
+            ++*this;
+            return temp;
+        }
+
+        // Position of the iterator in the list.
+        [[nodiscard]]
+        size_type index() const noexcept
+        {
+            return m_index;
+        }
+
+        friend bool operator==(const const_iterator& it1, const const_iterator& it2)
+        {
+            return it1.m_index == it2.m_index;
+        }
+
+    private:
+        const DeltaArrayList* m_list{nullptr};
+        size_type             m_index{};
+        size_type             m_offset{}; // Gap of the next item.
+        value_type            m_value{};
+    };
+
+    DeltaArrayList() = default;
+
+    // Append "value". Throws if it is smaller than the last item.
+    void append(const value_type value)
+    {
+        if (m_size != 0 && value < m_last)
+        {
+            throw std::invalid_argument{"Items must be appended in order."};
+        }
+
+        if (m_size % BlockSize == 0)
+        {
+            m_skips.append(SkipEntry{value, m_bytes.size()});
+        }
+        else
+        {
+            encode(value - m_last);
+        }
+
+        m_last = value;
+        ++m_size;
+    }
+
+    // Return the item at "pos". Decodes up to BlockSize - 1 gaps.
+    value_type operator[](const size_type pos) const noexcept
+    {
+        const SkipEntry&    skip  = m_skips[pos / BlockSize];
+        const std::uint8_t* bytes = m_bytes.data();
+
+        value_type value{skip.first};
+        size_type  offset{skip.offset};
+
+        for (size_type i = pos % BlockSize; i > 0; --i)
+        {
+            value += decode(bytes, offset);
+        }
+        return value;
+    }
+
+    value_type at(const size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Return iterator at the first item not less than "value", or end().
+    const_iterator lower_bound(const value_type value) const
+    {
+        if (m_size == 0 || m_last < value)
+        {
+            return end();
+        }
+
+        // Find the last block starting below "value", the item is in it
+        // or it is the first item of the next block.
+        size_type low{0};
+        size_type high{m_skips.size()};
+        while (low < high)
+        {
+            const size_type mid{low + (high - low) / 2};
+            if (m_skips[mid].first < value)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        if (low == 0)
+        {
+            return begin(); // Every item is at least "value".
+        }
+
+        const SkipEntry& skip = m_skips[low - 1];
+        const_iterator   it{this, (low - 1) * BlockSize, skip.offset, skip.first};
+
+        while (*it < value)
+        {
+            ++it;
+        }
+        return it;
+    }
+
+    [[nodiscard]]
+    bool contains(const value_type value) const
+    {
+        const const_iterator it = lower_bound(value);
+        return it != end() && *it == value;
+    }
+
+    // Decode every item into "out", which must have room for size() items.
+    void decode_all(value_type* out) const
+    {
+        for (const auto item : *this)
+        {
+            *out++ = item;
+        }
+    }
+
+    void clear()
+    {
+        m_bytes.clear();
+        m_skips.clear();
+        m_size = 0;
+        m_last = value_type{};
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    // Bytes taken by the gaps and the skip index.
+    [[nodiscard]]
+    size_type memory_bytes() const noexcept
+    {
+        return m_bytes.capacity() * sizeof(std::uint8_t) +
+               m_skips.capacity() * sizeof(SkipEntry);
+    }
+
+    const_iterator begin() const
+    {
+        if (m_size == 0)
+        {
+            return end();
+        }
+        return const_iterator{this, 0, m_skips[0].offset, m_skips[0].first};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{this, m_size, 0, value_type{}};
+    }
+};
+
+template <std::unsigned_integral T, std::size_t BlockSize>
+std::ostream& operator<<(std::ostream& os, const DeltaArrayList<T, BlockSize>& list)
+{
+    for (const auto item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // DELTAARRAYLIST_HPP
@@ -4,12 +4,28 @@
 #include "ForwardListIterator.hpp"
 #include "List.hpp"
 #include "Node.hpp"
-
-#include <cstddef>  // std::size_t
-#include <iostream> // operator<<
-#include <utility>  // std::move, std::exchange
-
-template <typename T>
+#include "NodeAllocator.hpp"
+
+#include <concepts>         // std::convertible_to, std::same_as
+#include <cstddef>          // std::size_t
+#include <functional>       // std::less, std::equal_to
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <iterator>         // std::input_iterator, std::sentinel_for
+#include <memory>           // std::construct_at, std::destroy_at, std::destroy_n
+#include <new>              // std::align_val_t
+#include <ranges>           // std::ranges::input_range, std::ranges::subrange
+#include <stdexcept>        // std::out_of_range
+#include <type_traits>      // std::is_trivially_destructible_v, std::remove_cvref_t
+#include <utility>          // std::move, std::exchange, std::forward, std::pair
+
+/**
+ * @brief A singly linked list.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam Allocator Where the nodes come from, see NodeAllocator.hpp.
+ */
+template <typename T, typename Allocator = HeapNodeAllocator<Node<T>>>
 class ForwardList : public List<T>
 {
 private:
@@ -18,36 +34,386 @@ private:
 
     std::size_t m_size{};
 
-public:
-    ForwardList() = default;
+    // Nodes built in one go from a range, laid out in list order so that
+    // walking them is a sequential memory walk. Its storage is freed once
+    // the last of its nodes is, the allocator never sees them.
+    struct alignas(Node<T>) NodeBlock
+    {
+        std::size_t count; // Nodes in the block.
+        std::size_t live;  // Nodes not freed yet.
 
-    ForwardList(const std::initializer_list<T> i_list)
+        // The nodes follow the header.
+        Node<T>* nodes() noexcept
+        {
+            return reinterpret_cast<Node<T>*>(this + 1);
+        }
+    };
+
+    NodeBlock* m_block{nullptr};
+
+    // Hands out the nodes. Takes no space when it is stateless.
+    [[no_unique_address]] Allocator m_allocator{};
+
+    // Whether "node" lives in m_block.
+    bool in_block(const Node<T>* node) const noexcept
     {
-        for (const auto& item : i_list)
+        if (m_block == nullptr)
         {
-            append(item);
+            return false;
         }
+
+        // std::less gives a total order even for unrelated pointers.
+        const Node<T>* first = m_block->nodes();
+        return !std::less<>{}(node, first) && std::less<>{}(node, first + m_block->count);
     }
 
-    // Copy constructor.
-    ForwardList(const ForwardList<T>& other)
-        : List<T>{}
+    void release_block() noexcept
     {
-        auto temp = other.m_head;
+        if (m_block != nullptr)
+        {
+            ::operator delete(std::exchange(m_block, nullptr),
+                              std::align_val_t{alignof(NodeBlock)});
+        }
+    }
 
-        while (temp != nullptr)
+    // Build the nodes of an empty list from "range". A range whose length is
+    // known up front gets a single NodeBlock, others are appended one by one.
+    template <typename R>
+    void build_nodes(R&& range)
+    {
+        if constexpr (std::ranges::forward_range<R>)
         {
-            // Append to our list and update the other's pointer position.
-            append(temp->data);
-            temp = temp->next;
+            const auto count = static_cast<std::size_t>(std::ranges::distance(range));
+            if (count == 0)
+            {
+                return;
+            }
+
+            void* storage = ::operator new(sizeof(NodeBlock) + count * sizeof(Node<T>),
+                                           std::align_val_t{alignof(NodeBlock)});
+
+            auto*       block = ::new (storage) NodeBlock{count, count};
+            Node<T>*    nodes = block->nodes();
+            std::size_t built{};
+
+            try
+            {
+                for (auto&& item : range)
+                {
+                    std::construct_at(nodes + built, std::forward<decltype(item)>(item));
+                    if (built > 0)
+                    {
+                        nodes[built - 1].next = nodes + built;
+                    }
+                    ++built;
+                }
+            }
+            catch (...)
+            {
+                std::destroy_n(nodes, built);
+                ::operator delete(storage, std::align_val_t{alignof(NodeBlock)});
+                throw;
+            }
+
+            m_block = block;
+            m_head  = nodes;
+            m_tail  = nodes + count - 1;
+            m_size  = count;
+        }
+        else
+        {
+            for (auto&& item : range)
+            {
+                append(item);
+            }
+        }
+    }
+
+    // Create a node holding "item" and pointing to "next".
+    template <typename U>
+    Node<T>* make_node(U&& item, Node<T>* next = nullptr)
+    {
+        Node<T>* node = m_allocator.allocate();
+
+        try
+        {
+            std::construct_at(node, std::forward<U>(item), next);
+        }
+        catch (...)
+        {
+            m_allocator.deallocate(node);
+            throw;
+        }
+
+        return node;
+    }
+
+    // Destroy "node" and give its storage back.
+    void free_node(Node<T>* node) noexcept
+    {
+        std::destroy_at(node);
+
+        if (in_block(node))
+        {
+            // The block goes with its last node.
+            if (--m_block->live == 0)
+            {
+                release_block();
+            }
+        }
+        else
+        {
+            m_allocator.deallocate(node);
+        }
+    }
+
+    // Destroy every node and empty the list.
+    void destroy_nodes() noexcept
+    {
+        if constexpr (Allocator::bulk_release)
+        {
+            // The allocator frees all the storage at once, only the items
+            // have to be destroyed. Trivial ones not even that.
+            if constexpr (!std::is_trivially_destructible_v<T>)
+            {
+                Node<T>* temp = m_head;
+                while (temp != nullptr)
+                {
+                    std::destroy_at(std::exchange(temp, temp->next));
+                }
+            }
+            m_allocator.release();
+            release_block();
+        }
+        else
+        {
+            // Start from the beginning.
+            Node<T>* temp = m_head;
+
+            // Traverse the list while deleting previous elements.
+            while (temp != nullptr)
+            {
+                temp = temp->next;  // Move forward.
+                free_node(m_head); // Delete the previous element.
+                m_head = temp;      // m_head moved one forward.
+            }
         }
+
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_size = 0;
     }
 
-    ForwardList(ForwardList<T>&& other) noexcept
-        // Member-wise move.
+    // Free the nodes first..last, which are no longer in the list.
+    void free_chain(Node<T>* first, Node<T>* last) noexcept
+    {
+        while (first != last)
+        {
+            free_node(std::exchange(first, first->next));
+        }
+        free_node(last);
+    }
+
+    // Return a chain this list can own holding the items of first..last,
+    // nodes of "other". Those are the nodes themselves if they can be handed
+    // over, otherwise the items are moved to new nodes and "last" is set to
+    // the new last node. The caller frees the old nodes then.
+    Node<T>* adopt(ForwardList& other, Node<T>* first, Node<T>*& last)
+    {
+        // Nodes of a block can't change lists, the block has a single owner.
+        if ((Allocator::is_always_equal && other.m_block == nullptr) || &other == this)
+        {
+            return first;
+        }
+
+        Node<T>* head = nullptr;
+        Node<T>* tail = nullptr;
+
+        try
+        {
+            for (Node<T>* node = first;; node = node->next)
+            {
+                Node<T>* moved = make_node(std::move(node->data));
+                (tail == nullptr ? head : tail->next) = moved;
+                tail = moved;
+
+                if (node == last)
+                {
+                    break;
+                }
+            }
+        }
+        catch (...)
+        {
+            if (head != nullptr)
+            {
+                free_chain(head, tail);
+            }
+            throw;
+        }
+
+        last = tail;
+        return head;
+    }
+
+    // Take every node of "other", leaving it empty.
+    // Return the chain of them, see adopt().
+    Node<T>* adopt_all(ForwardList& other, Node<T>*& last)
+    {
+        last           = other.m_tail;
+        Node<T>* first = adopt(other, other.m_head, last);
+
+        if (first == other.m_head)
+        {
+            // Handed over, "other" just forgets them.
+            other.m_head = nullptr;
+            other.m_tail = nullptr;
+            other.m_size = 0;
+        }
+        else
+        {
+            other.destroy_nodes();
+        }
+
+        return first;
+    }
+
+    // Link the chain first..last of "count" nodes after "pos".
+    // A null "pos" links it before the head.
+    void link_after(Node<T>* pos, Node<T>* first, Node<T>* last, const std::size_t count) noexcept
+    {
+        if (pos == nullptr)
+        {
+            last->next = m_head;
+            m_head     = first;
+
+            if (m_tail == nullptr)
+            {
+                m_tail = last;
+            }
+        }
+        else
+        {
+            last->next = pos->next;
+            pos->next  = first;
+
+            if (pos == m_tail)
+            {
+                m_tail = last;
+            }
+        }
+
+        m_size += count;
+    }
+
+    // Return the node "pos" of "list" points at, or nullptr if it is the
+    // list's before_begin(). Throws std::out_of_range for end(), there is
+    // nothing after it.
+    static Node<T>* node_of(ForwardListIterator<T> pos, const ForwardList& list)
+    {
+        if (pos.head_link() == &list.m_head)
+        {
+            return nullptr;
+        }
+
+        // The iterator's operator-> yields the node.
+        if (pos.operator->() == nullptr)
+        {
+            throw std::out_of_range{"No position after end()."};
+        }
+        return pos.operator->();
+    }
+
+    // Cut the chain starting at "node" after "count" nodes.
+    // Return the rest of it.
+    static Node<T>* split_after(Node<T>* node, std::size_t count) noexcept
+    {
+        for (; node != nullptr && count > 1; --count)
+        {
+            node = node->next;
+        }
+
+        if (node == nullptr)
+        {
+            return nullptr;
+        }
+
+        return std::exchange(node->next, nullptr);
+    }
+
+    // Merge the sorted chains "left" and "right" by relinking them.
+    // Equal items keep "left" first. Return the first and last node.
+    template <typename Compare>
+    static std::pair<Node<T>*, Node<T>*> merge_chains(Node<T>* left, Node<T>* right, Compare& comp)
+    {
+        Node<T>*  first = nullptr;
+        Node<T>*  last  = nullptr;
+        Node<T>** link  = &first; // Where the next node is linked.
+
+        while (left != nullptr && right != nullptr)
+        {
+            Node<T>*& taken = comp(right->data, left->data) ? right : left;
+
+            *link = taken;
+            last  = taken;
+            link  = &taken->next;
+            taken = taken->next;
+        }
+
+        // Append what's left of either chain and find its end.
+        *link = left != nullptr ? left : right;
+
+        if (last == nullptr)
+        {
+            last = first;
+        }
+        while (last != nullptr && last->next != nullptr)
+        {
+            last = last->next;
+        }
+
+        return {first, last};
+    }
+
+public:
+    ForwardList() = default;
+
+    // The nodes of the constructors taking items are a single NodeBlock.
+    ForwardList(const std::initializer_list<T> i_list)
+    {
+        build_nodes(i_list);
+    }
+
+    // Constructor with a range of items.
+    template <std::ranges::input_range R>
+        requires(!std::same_as<std::remove_cvref_t<R>, ForwardList> &&
+                 std::convertible_to<std::ranges::range_reference_t<R>, T>)
+    explicit ForwardList(R&& range)
+    {
+        build_nodes(std::forward<R>(range));
+    }
+
+    // Constructor with an iterator pair.
+    template <std::input_iterator It, std::sentinel_for<It> S>
+    ForwardList(It first, S last)
+    {
+        build_nodes(std::ranges::subrange(std::move(first), std::move(last)));
+    }
+
+    // Copy constructor.
+    ForwardList(const ForwardList& other)
+        : List<T>{}
+    {
+        build_nodes(other);
+    }
+
+    ForwardList(ForwardList&& other) noexcept
+        // Member-wise move. The nodes stay with the allocator they came from.
         : m_head{std::exchange(other.m_head, nullptr)},
           m_tail{std::exchange(other.m_tail, nullptr)},
-          m_size{std::exchange(other.m_size, 0ull)}
+          m_size{std::exchange(other.m_size, 0ull)},
+          m_block{std::exchange(other.m_block, nullptr)},
+          m_allocator{std::move(other.m_allocator)}
     {
         other.m_head = nullptr;
         other.m_tail = nullptr;
@@ -56,31 +422,46 @@ public:
 
     ~ForwardList()
     {
-        // Start from the beginning.
-        Node<T>* temp = m_head;
-
-        // Traverse the list while deleting previous elements.
-        while (temp != nullptr)
-        {
-            temp = temp->next; // Move forward.
-            delete m_head;     // Delete the previous element.
-            m_head = temp;     // m_head moved one forward.
-        }
+        destroy_nodes();
     }
 
-    ForwardList& operator=(const ForwardList<T>& other)
+    ForwardList& operator=(const ForwardList& other)
     {
         if (&other != this)
         {
-            // Delete the current list one by one.
-            while (m_size > 0ull)
+            auto other_head = other.m_head; // Start from the beginning of the other list.
+
+            Node<T>* temp = m_head;
+            Node<T>* last = nullptr; // Last node that got an item of the other list.
+
+            // Reuse the nodes we already have by assigning over their items.
+            while (other_head != nullptr && temp != nullptr)
             {
-                remove_back();
+                temp->data = other_head->data;
+
+                last       = temp;
+                temp       = temp->next;
+                other_head = other_head->next;
             }
 
-            auto other_head = other.m_head; // Start from the beginning of the other list.
+            if (last == nullptr)
+            {
+                // Either list is empty, nothing to reuse.
+                clear();
+                build_nodes(other);
+                return *this;
+            }
+            else if (temp != nullptr)
+            {
+                // The other list is shorter, free the nodes left over.
+                free_chain(temp, m_tail);
+
+                last->next = nullptr;
+                m_tail     = last;
+                m_size     = other.m_size;
+            }
 
-            // Traverse the other list while appending the elements to this list.
+            // Traverse the rest of the other list while appending the elements to this list.
             while (other_head != nullptr)
             {
                 append(other_head->data);
@@ -91,24 +472,41 @@ public:
         return *this;
     }
 
-    ForwardList& operator=(ForwardList<T>&& other) noexcept
+    ForwardList& operator=(ForwardList&& other) noexcept
     {
         if (&other != this)
         {
-            // Delete the current list one by one.
-            while (m_size > 0ull)
-            {
-                remove_back();
-            }
+            // Delete the current list in a single pass.
+            destroy_nodes();
+
+            // The nodes of "other" must go back to its allocator.
+            m_allocator = std::move(other.m_allocator);
 
-            m_head = std::exchange(other.m_head, nullptr);
-            m_tail = std::exchange(other.m_tail, nullptr);
-            m_size = std::exchange(other.m_size, 0ull);
+            m_head  = std::exchange(other.m_head, nullptr);
+            m_tail  = std::exchange(other.m_tail, nullptr);
+            m_size  = std::exchange(other.m_size, 0ull);
+            m_block = std::exchange(other.m_block, nullptr);
         }
 
         return *this;
     }
 
+    // Delete every node. With an allocator that frees its storage in one go
+    // this only runs the destructors of the items, if they have any.
+    void clear() noexcept
+    {
+        destroy_nodes();
+    }
+
+    // Replace the items with the ones of "range", see the range constructor.
+    template <std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, T>
+    void assign_range(R&& range)
+    {
+        clear();
+        build_nodes(std::forward<R>(range));
+    }
+
     // Iterator pointing at beginning.
     ForwardListIterator<T> begin() const
     {
@@ -118,17 +516,31 @@ public:
     // Iterator pointing one past the end.
     ForwardListIterator<T> end() const
     {
-        return ForwardListIterator{m_tail->next};
+        return ForwardListIterator<T>{nullptr};
     }
 
+    // Iterator before the first item, for the *_after members. Incrementing
+    // it gives begin(), it can't be dereferenced.
+    ForwardListIterator<T> before_begin() const
+    {
+        return ForwardListIterator<T>::before(m_head);
+    }
+
+    // What the node allocator has done so far.
     [[nodiscard]]
-    std::size_t size() const override
+    NodeAllocatorStats allocator_stats() const noexcept
+    {
+        return m_allocator.stats();
+    }
+
+    [[nodiscard]]
+    std::size_t size() const final
     {
         return m_size;
     }
     
     [[nodiscard]]
-    bool empty() const override
+    bool empty() const final
     {
         return size() == 0ull;
     }
@@ -136,24 +548,24 @@ public:
     void prepend(const T& item)
     {
         // Create a node holding our item and pointing to the head.
-        auto new_item = new Node<T>{item, m_head};
+        auto new_item = make_node(item, m_head);
 
         // If the head is the last element
         // (meaning it is the only element),
         // it'll be the tail.
         if (m_head == nullptr)
         {
-            m_tail = m_head;
+            m_tail = new_item;
         }
 
         m_head = new_item; // Update the head.
         m_size++;          // Don't forget to increment the size.
     }
 
-    void append(const T& item) override
+    void append(const T& item) final
     {
         // Create a node with no pointer.
-        auto new_item = new Node<T>{item};
+        auto new_item = make_node(item);
 
         if (m_tail == nullptr)
         {
@@ -172,7 +584,7 @@ public:
     }
 
     // Avoid illegal indexes by making pos unsigned.
-    void insert(const std::size_t pos, const T& item) override
+    void insert(const std::size_t pos, const T& item) final
     {
         // If the position is the beginning of the list, prepend the new node.
         if (pos == 0ull)
@@ -187,7 +599,7 @@ public:
         else
         {
             // Create a new node.
-            auto new_item = new Node<T>{item};
+            auto new_item = make_node(item);
 
             // Starting from the head, go to the one past the position.
             auto temp = m_head;
@@ -214,7 +626,7 @@ public:
         }
 
         m_head = m_head->next; // Move m_head one element forward.
-        delete temp;           // Get rid of the previous element.
+        free_node(temp);       // Get rid of the previous element.
 
         m_size--;
 
@@ -237,7 +649,7 @@ public:
         // If the list's size is 1.
         if (temp == m_tail)
         {
-            delete temp;
+            free_node(temp);
             m_head = m_tail = nullptr;
 
             --m_size;
@@ -253,7 +665,7 @@ public:
 
         m_tail = temp;
         // temp = temp->ahead;
-        delete temp->next;
+        free_node(temp->next);
 
         m_tail->next = nullptr;
 
@@ -261,7 +673,7 @@ public:
     }
 
     // Avoid illegal indexes by making pos unsigned.
-    void remove(const std::size_t pos) override
+    void remove(const std::size_t pos) final
     {
         if (pos == 0)
         {
@@ -288,7 +700,13 @@ public:
 
             // T removed_data = to_removed->data; // Retrieve the data before deleting the node.
 
-            delete to_removed; // Delete the to_removed.
+            // The tail was removed, the one before it is the new tail.
+            if (to_removed == m_tail)
+            {
+                m_tail = temp;
+            }
+
+            free_node(to_removed); // Delete the to_removed.
             m_size--;          // Don't forget to decrement the size.
 
             if (m_size == 0)
@@ -301,7 +719,7 @@ public:
         // return removed_data;
     }
 
-    T& operator[](const std::size_t pos) override
+    T& operator[](const std::size_t pos) final
     {
         Node<T>* temp = m_head;
 
@@ -313,7 +731,7 @@ public:
         return temp->data;
     }
 
-    const T& operator[](const std::size_t pos) const override
+    const T& operator[](const std::size_t pos) const final
     {
         Node<T>* temp = m_head;
 
@@ -340,13 +758,181 @@ public:
             current       = ahead;         // Move current one forward.
         }
 
+        m_tail = m_head; // The old head is at the end now.
         m_head = behind; // Update the head.
     }
+
+    /**
+     * @brief Sort the list by relinking the nodes, nothing is allocated.
+     *
+     * @details Bottom-up merge sort: runs of 1, 2, 4, ... nodes are merged
+     * pairwise until a single run is left. O(n log n) time and O(1) extra
+     * memory. Stable, equal items keep their order.
+     */
+    template <typename Compare = std::less<>>
+    void sort(Compare comp = Compare{})
+    {
+        for (std::size_t width{1}; width < m_size; width *= 2)
+        {
+            Node<T>* rest = m_head;
+            Node<T>* head = nullptr;
+            Node<T>* tail = nullptr;
+
+            while (rest != nullptr)
+            {
+                Node<T>* left  = rest;
+                Node<T>* right = split_after(left, width);
+                rest           = split_after(right, width);
+
+                const auto [first, last] = merge_chains(left, right, comp);
+
+                (tail == nullptr ? head : tail->next) = first;
+                tail = last;
+            }
+
+            m_head = head;
+            m_tail = tail;
+        }
+    }
+
+    // Merge the sorted "other" into this sorted list, leaving it empty.
+    // Equal items of this list come first. The nodes are relinked if the
+    // allocators allow it, otherwise the items are moved to new nodes.
+    template <typename Compare = std::less<>>
+    void merge(ForwardList& other, Compare comp = Compare{})
+    {
+        if (&other == this || other.empty())
+        {
+            return;
+        }
+
+        const std::size_t count{other.m_size};
+
+        Node<T>* last  = nullptr;
+        Node<T>* first = adopt_all(other, last);
+
+        const auto [head, tail] = merge_chains(m_head, first, comp);
+
+        m_head = head;
+        m_tail = tail;
+        m_size += count;
+    }
+
+    template <typename Compare = std::less<>>
+    void merge(ForwardList&& other, Compare comp = Compare{})
+    {
+        merge(other, comp);
+    }
+
+    // Move every item of "other" after "pos", leaving it empty.
+    // Pass before_begin() to put them before the first item.
+    void splice_after(ForwardListIterator<T> pos, ForwardList& other)
+    {
+        Node<T>* after = node_of(pos, *this);
+
+        if (&other == this || other.empty())
+        {
+            return;
+        }
+
+        const std::size_t count{other.m_size};
+
+        Node<T>* last  = nullptr;
+        Node<T>* first = adopt_all(other, last);
+
+        link_after(after, first, last, count);
+    }
+
+    void splice_after(ForwardListIterator<T> pos, ForwardList&& other)
+    {
+        splice_after(pos, other);
+    }
+
+    // Move the items of "other" strictly between "first" and "last" after
+    // "pos". Either of "pos" and "first" may be before_begin() of its list.
+    void splice_after(ForwardListIterator<T> pos,
+                      ForwardList&           other,
+                      ForwardListIterator<T> first,
+                      ForwardListIterator<T> last)
+    {
+        Node<T>* after  = node_of(pos, *this);
+        Node<T>* before = node_of(first, other);
+        Node<T>* stop   = last.operator->();
+
+        // The link that leads into the range.
+        Node<T>*& entry = before == nullptr ? other.m_head : before->next;
+
+        if (entry == stop)
+        {
+            return;
+        }
+
+        // Find the end of the range.
+        Node<T>*    chain_first = entry;
+        Node<T>*    chain_last  = chain_first;
+        std::size_t count{1};
+
+        while (chain_last->next != stop)
+        {
+            chain_last = chain_last->next;
+            ++count;
+        }
+
+        Node<T>* new_last  = chain_last;
+        Node<T>* new_first = adopt(other, chain_first, new_last);
+
+        // Unlink the range from "other".
+        entry = stop;
+        if (stop == nullptr)
+        {
+            other.m_tail = before;
+        }
+        other.m_size -= count;
+
+        if (new_first != chain_first)
+        {
+            other.free_chain(chain_first, chain_last);
+        }
+
+        link_after(after, new_first, new_last, count);
+    }
+
+    // Remove every item equal to the one before it.
+    // Return the number of removed items.
+    template <typename BinaryPredicate = std::equal_to<>>
+    std::size_t unique(BinaryPredicate pred = BinaryPredicate{})
+    {
+        if (m_head == nullptr)
+        {
+            return 0;
+        }
+
+        std::size_t removed{};
+        Node<T>*    node = m_head;
+
+        while (node->next != nullptr)
+        {
+            if (pred(node->data, node->next->data))
+            {
+                free_node(std::exchange(node->next, node->next->next));
+                ++removed;
+            }
+            else
+            {
+                node = node->next;
+            }
+        }
+
+        m_tail = node;
+        m_size -= removed;
+
+        return removed;
+    }
 };
 
 // Print the list.
-template <typename T>
-std::ostream& operator<<(std::ostream& os, const ForwardList<T>& list)
+template <typename T, typename Allocator>
+std::ostream& operator<<(std::ostream& os, const ForwardList<T, Allocator>& list)
 {
     for (const auto& item : list)
     {
@@ -355,4 +941,8 @@ std::ostream& operator<<(std::ostream& os, const ForwardList<T>& list)
 
     return os;
 }
+
+// A ForwardList whose nodes come from slabs, see SlabNodeAllocator.
+template <typename T, std::size_t SlabNodes = SLAB_NODE_COUNT>
+using SlabForwardList = ForwardList<T, SlabNodeAllocator<Node<T>, SlabNodes>>;
 #endif // FORWARDLIST_HPP
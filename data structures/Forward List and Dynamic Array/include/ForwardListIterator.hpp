@@ -31,6 +31,21 @@ public:
     {
     }
 
+    // The iterator before the first node of the list whose head pointer is
+    // "head". Incrementing it gives the iterator at that first node.
+    static ForwardListIterator before(pointer const& head)
+    {
+        ForwardListIterator it{};
+        it.m_head = &head;
+        return it;
+    }
+
+    // The head pointer a before() iterator comes before, nullptr otherwise.
+    const pointer* head_link() const
+    {
+        return m_head;
+    }
+
     // Access the data directly at the current iterator position.
     reference operator*() const
     {
@@ -46,7 +61,16 @@ public:
     // To move one position forward. (Pre-increment)
     ForwardListIterator& operator++()
     {
-        m_ptr = m_ptr->next;
+        if (m_head != nullptr)
+        {
+            // Step from before the first node onto it.
+            m_ptr  = *m_head;
+            m_head = nullptr;
+        }
+        else
+        {
+            m_ptr = m_ptr->next;
+        }
         return *this;
     }
 
@@ -61,16 +85,17 @@ public:
     // To compare iterators for equality.
     bool operator==(const ForwardListIterator& other) const
     {
-        return m_ptr == other.m_ptr;
+        return m_ptr == other.m_ptr && m_head == other.m_head;
     }
 
     // To compare iterators for inequality.
     bool operator!=(const ForwardListIterator& other) const
     {
-        return m_ptr != other.m_ptr;
+        return !(*this == other);
     }
 
 private:
-    pointer m_ptr{nullptr};
+    pointer        m_ptr{nullptr};
+    const pointer* m_head{nullptr}; // Set only before the first node.
 };
 #endif // FORWARDLISTITERATOR_HPP
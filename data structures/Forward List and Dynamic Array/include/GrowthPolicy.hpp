@@ -0,0 +1,77 @@
+// Growth policies decide how much a dynamic array grows once it is full.
+#ifndef GROWTHPOLICY_HPP
+#define GROWTHPOLICY_HPP
+
+#include <algorithm> // std::max
+#include <concepts>  // std::same_as
+#include <cstddef>   // std::size_t
+#include <limits>    // std::numeric_limits
+
+constexpr std::size_t INITIAL_SIZE{2};  // Capacity of the first allocation.
+constexpr std::size_t GROWTH_FACTOR{2}; // Default geometric growth factor.
+
+// A policy maps the current capacity and the capacity that is required at
+// least to the new capacity. The result must not be less than "required".
+template <typename P>
+concept GrowthPolicy = requires(const std::size_t capacity,
+                                const std::size_t required) {
+    { P::grow(capacity, required) } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @brief Multiply the capacity by Numerator / Denominator on each growth.
+ *
+ * @details Appends are amortized O(1) for any factor above 1. Factors below
+ * the golden ratio, like 1.5, let the allocator reuse the blocks freed by
+ * earlier growths, 2 does fewer reallocations.
+ */
+template <std::size_t Numerator, std::size_t Denominator = 1>
+struct GeometricGrowth
+{
+    static_assert(Denominator > 0 && Numerator > Denominator,
+                  "Growth factor must be greater than 1.");
+
+    static std::size_t grow(const std::size_t capacity,
+                            const std::size_t required)
+    {
+        if (capacity == 0)
+        {
+            return std::max(INITIAL_SIZE, required);
+        }
+
+        // Don't overflow on huge capacities, just give what is required.
+        if (capacity > std::numeric_limits<std::size_t>::max() / Numerator)
+        {
+            return std::max(capacity, required);
+        }
+
+        // Always grow by at least one, e.g. 1 * 3 / 2 is still 1.
+        const std::size_t next{
+            std::max(capacity * Numerator / Denominator, capacity + 1)};
+
+        return std::max(next, required);
+    }
+};
+
+using DoublingGrowth   = GeometricGrowth<GROWTH_FACTOR>;
+using OneAndHalfGrowth = GeometricGrowth<3, 2>;
+
+/**
+ * @brief Add a fixed number of slots on each growth.
+ *
+ * @details Appends cost O(n) amortized, but memory never overshoots by more
+ * than Increment elements.
+ */
+template <std::size_t Increment>
+struct FixedIncrementGrowth
+{
+    static_assert(Increment > 0, "Increment must be at least 1.");
+
+    static std::size_t grow(const std::size_t capacity,
+                            const std::size_t required)
+    {
+        return std::max(capacity + Increment, required);
+    }
+};
+
+#endif // GROWTHPOLICY_HPP
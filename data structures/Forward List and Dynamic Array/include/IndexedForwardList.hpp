@@ -0,0 +1,377 @@
+// A singly linked list with a skip list index over it for positional access.
+#ifndef INDEXEDFORWARDLIST_HPP
+#define INDEXEDFORWARDLIST_HPP
+
+#include "IndexedForwardListIterator.hpp"
+#include "IndexedNode.hpp"
+#include "List.hpp"
+
+#include <algorithm>        // std::min
+#include <bit>              // std::countr_zero
+#include <cstddef>          // std::size_t
+#include <cstdint>          // std::uint64_t
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <memory>           // std::destroy_at
+#include <new>              // ::operator new, std::align_val_t
+#include <stdexcept>        // std::out_of_range
+#include <utility>          // std::exchange, std::swap
+
+// Maximum number of levels. With a quarter of the nodes reaching each next
+// level, that is enough for 4^16 items.
+constexpr std::size_t INDEXED_MAX_LEVEL{16};
+
+/**
+ * @brief A singly linked list with express lanes for positional access.
+ *
+ * @details The nodes form a plain singly linked list on level 0. A quarter of
+ * them also link to the next node of level 1, a quarter of those to the
+ * next of level 2 and so on, like a skip list. Every link knows how many
+ * positions it jumps, so reaching position i takes the longest jumps that
+ * don't overshoot it: expected O(log n) steps for operator[], insert and
+ * remove. Iterating only follows level 0.
+ *
+ * @tparam T The type of the items in the list.
+ */
+template <typename T>
+class IndexedForwardList : public List<T>
+{
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = IndexedForwardListIterator<value_type>;
+    using const_iterator  = IndexedForwardListIterator<const value_type>;
+
+private:
+    using node_type = IndexedNode<value_type>;
+    using link_type = typename node_type::Link;
+
+    // Links of the head, which comes before position 0 and holds no item.
+    link_type m_head[INDEXED_MAX_LEVEL]{};
+
+    size_type     m_level{1}; // Number of levels in use.
+    size_type     m_size{};   // Current number of list elements.
+    std::uint64_t m_seed{0x9E3779B97F4A7C15}; // State of the height generator.
+
+    // Number of levels for a new node: 1 with probability 3/4, 2 with 3/16...
+    size_type random_height() noexcept
+    {
+        // xorshift64, plenty for coin flips.
+        m_seed ^= m_seed << 13;
+        m_seed ^= m_seed >> 7;
+        m_seed ^= m_seed << 17;
+
+        // Two bits per flip, both must be zero to go up.
+        const auto height = static_cast<size_type>(std::countr_zero(m_seed) / 2 + 1);
+        return std::min(height, INDEXED_MAX_LEVEL);
+    }
+
+    static node_type* make_node(const_reference item, const size_type height)
+    {
+        // The links follow the node, sizeof(node_type) keeps them aligned.
+        void* storage = ::operator new(sizeof(node_type) + height * sizeof(link_type),
+                                       std::align_val_t{alignof(node_type)});
+
+        node_type* node{nullptr};
+        try
+        {
+            node = ::new (storage) node_type{item, height};
+        }
+        catch (...)
+        {
+            ::operator delete(storage, std::align_val_t{alignof(node_type)});
+            throw;
+        }
+
+        for (size_type level{}; level < height; ++level)
+        {
+            ::new (node->links() + level) link_type{};
+        }
+        return node;
+    }
+
+    static void free_node(node_type* node) noexcept
+    {
+        std::destroy_at(node);
+        ::operator delete(node, std::align_val_t{alignof(node_type)});
+    }
+
+    // Go to the last node before position "pos" on every level. Store the
+    // link to follow from there in "update" and the node's position plus
+    // one, the head being 0, in "rank".
+    void find_before(const size_type pos, link_type** update, size_type* rank) noexcept
+    {
+        link_type* links = m_head;
+        size_type  steps{};
+
+        for (size_type level = m_level; level-- > 0;)
+        {
+            while (links[level].next != nullptr && steps + links[level].span <= pos)
+            {
+                steps += links[level].span;
+                links = links[level].next->links();
+            }
+
+            update[level] = links + level;
+            rank[level]   = steps;
+        }
+    }
+
+    // Return the node at "pos", which must be less than m_size.
+    node_type* node_at(const size_type pos) const noexcept
+    {
+        const link_type* links = m_head;
+        node_type*       node{nullptr};
+        size_type        remaining{pos + 1}; // Steps still to take.
+
+        for (size_type level = m_level; level-- > 0;)
+        {
+            while (links[level].next != nullptr && links[level].span <= remaining)
+            {
+                remaining -= links[level].span;
+                node  = links[level].next;
+                links = node->links();
+            }
+
+            if (remaining == 0)
+            {
+                break;
+            }
+        }
+        return node;
+    }
+
+public:
+    // Default constructor.
+    IndexedForwardList() = default;
+
+    // Constructor with initializer list.
+    IndexedForwardList(const std::initializer_list<value_type> i_list)
+    {
+        for (const auto& item : i_list)
+        {
+            append(item);
+        }
+    }
+
+    // Copy constructor.
+    IndexedForwardList(const IndexedForwardList& other)
+        : List<value_type>{}
+    {
+        for (const auto& item : other)
+        {
+            append(item);
+        }
+    }
+
+    // Move constructor.
+    IndexedForwardList(IndexedForwardList&& other) noexcept
+    {
+        swap(other);
+    }
+
+    // Copy and move assignment operator.
+    IndexedForwardList& operator=(IndexedForwardList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor.
+    ~IndexedForwardList()
+    {
+        clear();
+    }
+
+    void swap(IndexedForwardList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_level, other.m_level);
+        std::swap(m_size, other.m_size);
+        std::swap(m_seed, other.m_seed);
+    }
+
+    // Delete every node.
+    void clear() noexcept
+    {
+        node_type* node = m_head[0].next;
+        while (node != nullptr)
+        {
+            free_node(std::exchange(node, node->next()));
+        }
+
+        for (auto& link : m_head)
+        {
+            link = link_type{};
+        }
+        m_level = 1;
+        m_size  = 0;
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        link_type* update[INDEXED_MAX_LEVEL]{};
+        size_type  rank[INDEXED_MAX_LEVEL]{};
+        find_before(pos, update, rank);
+
+        const size_type height = random_height();
+        node_type*      node   = make_node(item, height);
+
+        // New levels start at the head and reach past the end.
+        for (; m_level < height; ++m_level)
+        {
+            m_head[m_level].span = m_size;
+            update[m_level]      = m_head + m_level;
+            rank[m_level]        = 0;
+        }
+
+        link_type* links = node->links();
+        for (size_type level{}; level < height; ++level)
+        {
+            // The node splits the jump of update[level] in two.
+            links[level].next = update[level]->next;
+            links[level].span = update[level]->span - (pos - rank[level]);
+
+            update[level]->next = node;
+            update[level]->span = pos - rank[level] + 1;
+        }
+
+        // Jumps over the new node got one longer.
+        for (size_type level{height}; level < m_level; ++level)
+        {
+            ++update[level]->span;
+        }
+
+        ++m_size;
+    }
+
+    // Append "item".
+    void append(const_reference item) final
+    {
+        insert(m_size, item);
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        link_type* update[INDEXED_MAX_LEVEL]{};
+        size_type  rank[INDEXED_MAX_LEVEL]{};
+        find_before(pos, update, rank);
+
+        node_type*       node  = update[0]->next;
+        const link_type* links = node->links();
+
+        for (size_type level{}; level < m_level; ++level)
+        {
+            if (update[level]->next == node)
+            {
+                // Jump straight to where the node jumped.
+                update[level]->span += links[level].span - 1;
+                update[level]->next = links[level].next;
+            }
+            else
+            {
+                --update[level]->span;
+            }
+        }
+
+        // Drop levels that became empty.
+        while (m_level > 1 && m_head[m_level - 1].next == nullptr)
+        {
+            --m_level;
+        }
+
+        free_node(node);
+        --m_size;
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return m_size == 0;
+    }
+
+    // Expected O(log n).
+    reference operator[](const size_type pos) final
+    {
+        return node_at(pos)->data;
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        return node_at(pos)->data;
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(const size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Iterator pointing at beginning.
+    iterator begin()
+    {
+        return iterator{m_head[0].next};
+    }
+
+    // Iterator pointing one past the end.
+    iterator end()
+    {
+        return iterator{nullptr};
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{m_head[0].next};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{nullptr};
+    }
+};
+
+// Print the list.
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const IndexedForwardList<T>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+
+    return os;
+}
+#endif // INDEXEDFORWARDLIST_HPP
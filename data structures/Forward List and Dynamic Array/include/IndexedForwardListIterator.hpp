@@ -0,0 +1,90 @@
+// This is an iterator class for convenient use of STL algorithms.
+#ifndef INDEXEDFORWARDLISTITERATOR_HPP
+#define INDEXEDFORWARDLISTITERATOR_HPP
+
+#include "IndexedNode.hpp"
+
+#include <cstddef>     // std::ptrdiff_t
+#include <iterator>    // std::forward_iterator_tag
+#include <type_traits> // std::conditional_t, std::is_const_v, std::remove_const_t
+
+// This class is used in order to be compliant with the STL algorithms.
+// It only follows the bottom level, so iterating costs the same as with a
+// ForwardList.
+// IndexedForwardListIterator<const T> is the const_iterator.
+template <typename T>
+class IndexedForwardListIterator
+{
+public:
+    // std::forward_iterator_tag since we can only move forward in a singly linked list.
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_const_t<T>;
+    using pointer           = T*;
+    using reference         = T&;
+
+private:
+    using node_pointer = std::conditional_t<std::is_const_v<T>,
+                                            const IndexedNode<value_type>*,
+                                            IndexedNode<value_type>*>;
+
+    node_pointer m_ptr{nullptr};
+
+public:
+    // Default constructor.
+    IndexedForwardListIterator() = default;
+
+    // Constructor with pointer.
+    explicit IndexedForwardListIterator(node_pointer ptr)
+        : m_ptr{ptr}
+    {
+    }
+
+    // An iterator converts to a const_iterator, but not the other way.
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    IndexedForwardListIterator(const IndexedForwardListIterator<U>& other)
+        : m_ptr{other.node()}
+    {
+    }
+
+    // Access the data directly at the current iterator position.
+    reference operator*() const
+    {
+        return m_ptr->data;
+    }
+
+    // To point at the current iterator position.
+    pointer operator->() const
+    {
+        return &m_ptr->data;
+    }
+
+    // To move one position forward. (Pre-increment)
+    IndexedForwardListIterator& operator++()
+    {
+        m_ptr = m_ptr->next();
+        return *this;
+    }
+
+    // To move one position forward. (Post-increment)
+    IndexedForwardListIterator operator++(int)
+    {
+        IndexedForwardListIterator tmp = *this; // Save the current iterator position.
+        ++(*this);
+        return tmp;
+    }
+
+    // To compare iterators for equality.
+    friend bool operator==(const IndexedForwardListIterator& it1,
+                           const IndexedForwardListIterator& it2)
+    {
+        return it1.m_ptr == it2.m_ptr;
+    }
+
+    node_pointer node() const noexcept
+    {
+        return m_ptr;
+    }
+};
+#endif // INDEXEDFORWARDLISTITERATOR_HPP
@@ -0,0 +1,36 @@
+#ifndef INDEXEDNODE_HPP
+#define INDEXEDNODE_HPP
+
+#include <cstddef> // std::size_t
+
+// Node of an IndexedForwardList. Its links, one per level it takes part in,
+// are allocated right after it.
+template <typename T>
+struct IndexedNode
+{
+    struct Link
+    {
+        IndexedNode* next{nullptr}; // Next node on this level.
+        std::size_t  span{};        // Number of nodes the link skips over, plus one.
+    };
+
+    T           data{};   // Value of the node.
+    std::size_t height{}; // Number of links.
+
+    // Level 0 is the plain list, the ones above it are express lanes.
+    Link* links() noexcept
+    {
+        return reinterpret_cast<Link*>(this + 1);
+    }
+
+    const Link* links() const noexcept
+    {
+        return reinterpret_cast<const Link*>(this + 1);
+    }
+
+    IndexedNode* next() const noexcept
+    {
+        return links()[0].next;
+    }
+};
+#endif // INDEXEDNODE_HPP
@@ -3,7 +3,8 @@
 #ifndef LIST_HPP
 #define LIST_HPP
 
-#include <cstddef> // std::size_t
+#include <concepts> // std::convertible_to, std::same_as
+#include <cstddef>  // std::size_t
 #include <initializer_list>
 
 template <typename T>
@@ -45,4 +46,35 @@ public:
     // The const overload is called only when used on const object.
     virtual const T& operator[](const std::size_t pos) const = 0;
 };
+
+// The compile-time counterpart of List.
+// Generic code constrained on ListLike calls the members of the concrete type
+// directly instead of going through List's vtable, so the compiler can inline
+// and vectorize them. The lists in this directory mark their overrides final,
+// which lets calls through e.g. ArrayList<T>& bind statically as well.
+//
+// template <ListLike L>
+// auto sum(const L& list)
+// {
+//     typename L::value_type total{};
+//     for (std::size_t i{}; i < list.size(); ++i)
+//     {
+//         total += list[i]; // No indirect call.
+//     }
+//     return total;
+// }
+template <typename L>
+concept ListLike =
+    requires(L&                             list,
+             const L&                       const_list,
+             const std::size_t              pos,
+             const typename L::value_type& item) {
+        { const_list.size() } -> std::convertible_to<std::size_t>;
+        { const_list.empty() } -> std::convertible_to<bool>;
+        { list[pos] } -> std::same_as<typename L::value_type&>;
+        { const_list[pos] } -> std::same_as<const typename L::value_type&>;
+        list.insert(pos, item);
+        list.append(item);
+        list.remove(pos);
+    };
 #endif // LIST_HPP
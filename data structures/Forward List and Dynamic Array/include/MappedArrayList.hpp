@@ -0,0 +1,494 @@
+// An array-based list that lives in a memory-mapped file (POSIX only).
+#ifndef MAPPEDARRAYLIST_HPP
+#define MAPPEDARRAYLIST_HPP
+
+#include "ArrayListIterator.hpp"
+#include "GrowthPolicy.hpp"
+#include "List.hpp"
+
+#include <cerrno>       // errno
+#include <cstddef>      // std::byte, std::size_t
+#include <cstdint>      // std::uint64_t
+#include <algorithm>    // std::max
+#include <cstring>      // std::memmove
+#include <iostream>     // operator<<
+#include <limits>       // std::numeric_limits
+#include <stdexcept>    // std::out_of_range, std::logic_error, std::runtime_error, std::length_error
+#include <string>       // std::string
+#include <system_error> // std::system_error
+#include <type_traits>  // std::is_trivially_copyable_v
+#include <utility>      // std::exchange
+
+#include <fcntl.h>    // ::open
+#include <sys/mman.h> // ::mmap, ::mremap, ::msync, ::munmap
+#include <sys/stat.h> // ::fstat
+#include <unistd.h>   // ::close, ::ftruncate
+
+enum class MapMode
+{
+    read_write, // Open or create the file, the list can be changed.
+    read_only   // Open an existing file, every change throws.
+};
+
+/**
+ * @brief A list of trivially copyable items stored in a file.
+ *
+ * @details The file starts with a small header holding the size and the
+ * capacity of the list, followed by the items as raw bytes. Opening a file
+ * maps it without parsing or copying anything, so a list written by one
+ * process can be reopened by another instantly. Changes reach the file when
+ * the kernel writes the pages back, call sync() to force it.
+ *
+ * The file is in the byte order and layout of the machine that wrote it.
+ *
+ * A read-only list gives out const access only, the non-const accessors
+ * throw std::logic_error like every change does. A moved-from list is empty.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam Growth How much the file grows once it is full, see
+ * GrowthPolicy.hpp.
+ */
+template <typename T, GrowthPolicy Growth = DoublingGrowth>
+class MappedArrayList : public List<T>
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be stored as bytes.");
+
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = ArrayListIterator<value_type>;
+    using const_iterator  = ArrayListIterator<const value_type>;
+
+private:
+    // Layout of the beginning of the file.
+    struct Header
+    {
+        std::uint64_t magic;        // Tells our files apart from others.
+        std::uint64_t element_size; // sizeof(T) of the writer.
+        std::uint64_t size;         // Current number of list elements.
+        std::uint64_t capacity;     // Number of elements the file has room for.
+    };
+
+    // The items start here. Keeps them aligned for any reasonable T.
+    static constexpr std::size_t HEADER_BYTES{64};
+    static constexpr std::uint64_t MAGIC{0x5453494C50414D41}; // "AMAPLIST"
+
+    static_assert(sizeof(Header) <= HEADER_BYTES);
+    static_assert(alignof(T) <= HEADER_BYTES, "Items can't be aligned.");
+
+    int        m_fd{-1};                   // Descriptor of the backing file.
+    MapMode    m_mode{MapMode::read_write}; // How the file was opened.
+    std::byte* m_map{nullptr};             // Start of the mapping.
+    size_type  m_map_bytes{};              // Length of the mapping.
+
+    [[noreturn]]
+    static void throw_errno(const char* what)
+    {
+        throw std::system_error{errno, std::generic_category(), what};
+    }
+
+    // Largest capacity whose size in bytes fits in size_type.
+    static constexpr size_type MAX_CAPACITY{
+        (std::numeric_limits<size_type>::max() - HEADER_BYTES) / sizeof(value_type)};
+
+    static size_type bytes_for(const size_type capacity) noexcept
+    {
+        return HEADER_BYTES + capacity * sizeof(value_type);
+    }
+
+    Header* header() const noexcept
+    {
+        return reinterpret_cast<Header*>(m_map);
+    }
+
+    // nullptr for a moved-from list.
+    pointer elements() const noexcept
+    {
+        return m_map == nullptr ? nullptr
+                                : reinterpret_cast<pointer>(m_map + HEADER_BYTES);
+    }
+
+    void map(const size_type bytes)
+    {
+        const int protection{m_mode == MapMode::read_only
+                                 ? PROT_READ
+                                 : PROT_READ | PROT_WRITE};
+
+        void* address =
+            ::mmap(nullptr, bytes, protection, MAP_SHARED, m_fd, 0);
+        if (address == MAP_FAILED)
+        {
+            throw_errno("mmap");
+        }
+
+        m_map       = static_cast<std::byte*>(address);
+        m_map_bytes = bytes;
+    }
+
+    // Unmap and close, leaving the file as it is.
+    void release() noexcept
+    {
+        if (m_map != nullptr)
+        {
+            ::munmap(m_map, m_map_bytes);
+        }
+        if (m_fd != -1)
+        {
+            ::close(m_fd);
+        }
+    }
+
+    void check_writable() const
+    {
+        if (m_mode == MapMode::read_only)
+        {
+            throw std::logic_error{"List is opened read-only."};
+        }
+    }
+
+    // Extend the file and the mapping to hold "new_capacity" elements.
+    // The mapping may move, so pointers into the list are invalidated.
+    void grow(const size_type new_capacity)
+    {
+        if (new_capacity > MAX_CAPACITY)
+        {
+            throw std::length_error{"Capacity too large for the file."};
+        }
+
+        struct stat info{};
+        if (::fstat(m_fd, &info) == -1)
+        {
+            throw_errno("fstat");
+        }
+
+        // The file may be longer than the items need, never cut it short.
+        const auto      file_bytes = static_cast<size_type>(info.st_size);
+        const size_type bytes{std::max(bytes_for(new_capacity), file_bytes)};
+
+        if (bytes > file_bytes && ::ftruncate(m_fd, static_cast<off_t>(bytes)) == -1)
+        {
+            throw_errno("ftruncate");
+        }
+
+#ifdef __linux__
+        void* address = ::mremap(m_map, m_map_bytes, bytes, MREMAP_MAYMOVE);
+        if (address == MAP_FAILED)
+        {
+            throw_errno("mremap");
+        }
+        m_map       = static_cast<std::byte*>(address);
+        m_map_bytes = bytes;
+#else
+        // No mremap, map the file again. The data is in the file, not in
+        // the mapping, so nothing is copied.
+        ::munmap(m_map, m_map_bytes);
+        m_map = nullptr;
+        map(bytes);
+#endif
+
+        header()->capacity = new_capacity;
+    }
+
+public:
+    /**
+     * @brief Open the list stored in "path".
+     *
+     * @details In read_write mode a missing or empty file is set up as an
+     * empty list. In read_only mode the file must already hold a list.
+     * Throws std::system_error if the file can't be opened or mapped, and
+     * std::runtime_error if it doesn't hold a list of T.
+     */
+    explicit MappedArrayList(const std::string& path,
+                             const MapMode      mode = MapMode::read_write)
+        : m_mode{mode}
+    {
+        const int flags{mode == MapMode::read_only ? O_RDONLY
+                                                   : O_RDWR | O_CREAT};
+
+        m_fd = ::open(path.c_str(), flags, 0644);
+        if (m_fd == -1)
+        {
+            throw_errno("open");
+        }
+
+        try
+        {
+            struct stat info{};
+            if (::fstat(m_fd, &info) == -1)
+            {
+                throw_errno("fstat");
+            }
+
+            const auto file_bytes = static_cast<size_type>(info.st_size);
+
+            if (file_bytes == 0 && mode == MapMode::read_write)
+            {
+                // A new file, write an empty list into it.
+                if (::ftruncate(m_fd, static_cast<off_t>(HEADER_BYTES)) == -1)
+                {
+                    throw_errno("ftruncate");
+                }
+                map(HEADER_BYTES);
+                *header() = Header{MAGIC, sizeof(value_type), 0, 0};
+                return;
+            }
+
+            if (file_bytes < HEADER_BYTES)
+            {
+                throw std::runtime_error{"File doesn't hold a list."};
+            }
+
+            map(file_bytes);
+
+            const Header& head = *header();
+            // Check the capacity first, bytes_for() would overflow on a
+            // corrupt one.
+            if (head.magic != MAGIC || head.element_size != sizeof(value_type) ||
+                head.size > head.capacity || head.capacity > MAX_CAPACITY ||
+                bytes_for(static_cast<size_type>(head.capacity)) > file_bytes)
+            {
+                throw std::runtime_error{"File doesn't hold a list of T."};
+            }
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    // A mapping has a single owner.
+    MappedArrayList(const MappedArrayList&)            = delete;
+    MappedArrayList& operator=(const MappedArrayList&) = delete;
+
+    // Move constructor.
+    MappedArrayList(MappedArrayList&& other) noexcept
+        : List<value_type>{},
+          m_fd{std::exchange(other.m_fd, -1)},
+          m_mode{other.m_mode},
+          m_map{std::exchange(other.m_map, nullptr)},
+          m_map_bytes{std::exchange(other.m_map_bytes, 0)}
+    {
+    }
+
+    // Move assignment operator.
+    MappedArrayList& operator=(MappedArrayList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release(); // Clean up.
+
+            m_fd        = std::exchange(other.m_fd, -1);
+            m_mode      = other.m_mode;
+            m_map       = std::exchange(other.m_map, nullptr);
+            m_map_bytes = std::exchange(other.m_map_bytes, 0);
+        }
+        return *this;
+    }
+
+    // Unmap the file. Changes are kept, but only sync() guarantees they are
+    // on disk.
+    ~MappedArrayList()
+    {
+        release();
+    }
+
+    // Write the changes back to the file and wait for it.
+    void sync() const
+    {
+        // A moved-from list has nothing to write.
+        if (m_map == nullptr)
+        {
+            return;
+        }
+
+        if (::msync(m_map, m_map_bytes, MS_SYNC) == -1)
+        {
+            throw_errno("msync");
+        }
+    }
+
+    [[nodiscard]]
+    bool is_read_only() const noexcept
+    {
+        return m_mode == MapMode::read_only;
+    }
+
+    // Return the number of elements the file has room for.
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_map == nullptr ? 0 : static_cast<size_type>(header()->capacity);
+    }
+
+    // Make room for at least "new_capacity" elements.
+    void reserve(const size_type new_capacity)
+    {
+        check_writable();
+
+        if (new_capacity > capacity())
+        {
+            grow(new_capacity);
+        }
+    }
+
+    // Empty the list. The file keeps its size.
+    void clear()
+    {
+        check_writable();
+
+        // A moved-from list is empty already.
+        if (m_map != nullptr)
+        {
+            header()->size = 0;
+        }
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        check_writable();
+
+        if (pos > size())
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        // "item" may live in the mapping, which can move on growth.
+        const value_type temp{item};
+
+        if (size() == capacity())
+        {
+            grow(Growth::grow(capacity(), size() + 1));
+        }
+
+        pointer items = elements();
+        std::memmove(items + pos + 1,
+                     items + pos,
+                     (size() - pos) * sizeof(value_type)); // Shift up.
+        items[pos] = temp;
+
+        header()->size++;
+    }
+
+    // Append "item".
+    void append(const_reference item) final
+    {
+        insert(size(), item);
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        check_writable();
+
+        if (pos >= size())
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        pointer items = elements();
+        std::memmove(items + pos,
+                     items + pos + 1,
+                     (size() - pos - 1) * sizeof(value_type)); // Shift down.
+
+        header()->size--;
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_map == nullptr ? 0 : static_cast<size_type>(header()->size);
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return size() == 0;
+    }
+
+    // Throws std::logic_error on a read-only list, use the const overload.
+    reference operator[](const size_type pos) final
+    {
+        check_writable();
+        return elements()[pos];
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        return elements()[pos];
+    }
+
+    reference at(const size_type pos)
+    {
+        check_writable();
+
+        if (pos >= size())
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return elements()[pos];
+    }
+
+    const_reference at(const size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return elements()[pos];
+    }
+
+    // Return iterator at beginning of list. Throws std::logic_error on a
+    // read-only list, use cbegin().
+    iterator begin()
+    {
+        check_writable();
+        return iterator{elements()};
+    }
+
+    // Return iterator past end of list.
+    iterator end()
+    {
+        check_writable();
+        return iterator{elements() + size()};
+    }
+
+    // Const iterators. Same as the regular iterators but read-only.
+    const_iterator begin() const
+    {
+        return const_iterator{elements()};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{elements() + size()};
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+};
+
+template <typename T, GrowthPolicy Growth>
+std::ostream& operator<<(std::ostream&                         os,
+                         const MappedArrayList<T, Growth>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // MAPPEDARRAYLIST_HPP
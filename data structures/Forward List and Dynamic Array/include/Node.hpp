@@ -1,6 +1,8 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+#include <utility> // std::move
+
 template <typename T>
 struct Node
 {
@@ -11,5 +13,10 @@ struct Node
         : data{dat}, next{nxt}
     {
     }
+
+    Node(T&& dat, Node* nxt = nullptr)
+        : data{std::move(dat)}, next{nxt}
+    {
+    }
 };
 #endif // NODE_HPP
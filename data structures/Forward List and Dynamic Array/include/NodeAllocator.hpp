@@ -0,0 +1,214 @@
+// Policies deciding where the nodes of a ForwardList come from.
+#ifndef NODEALLOCATOR_HPP
+#define NODEALLOCATOR_HPP
+
+#include <algorithm> // std::max
+#include <cstddef>   // std::size_t, std::byte
+#include <utility>   // std::exchange
+
+// Number of nodes carved out of one slab.
+constexpr std::size_t SLAB_NODE_COUNT{256};
+
+// What a node allocator has done so far.
+struct NodeAllocatorStats
+{
+    std::size_t allocations{};   // Nodes handed out.
+    std::size_t deallocations{}; // Nodes given back one by one.
+    std::size_t bytes{};         // Bytes currently taken from the system.
+    std::size_t peak_bytes{};    // Most bytes taken at once.
+};
+
+// A node allocator hands out uninitialized storage for one NodeT at a time:
+//
+// struct SomeNodeAllocator
+// {
+//     // Whether the storage can be given back with release() in one go,
+//     // without deallocating every node first.
+//     static constexpr bool bulk_release{...};
+//     // Whether any two instances can free each other's nodes. Lists may
+//     // only hand nodes to each other if so.
+//     static constexpr bool is_always_equal{...};
+//
+//     NodeT* allocate();
+//     void   deallocate(NodeT* node) noexcept;
+//     void   release() noexcept; // Every node is dead, free everything.
+//     NodeAllocatorStats stats() const noexcept;
+// };
+
+/**
+ * @brief Every node is a separate heap allocation.
+ *
+ * @details Stateless, so it takes no space in the list. It doesn't count
+ * either, stats() is all zeros.
+ *
+ * @tparam NodeT The type of the nodes.
+ */
+template <typename NodeT>
+class HeapNodeAllocator
+{
+public:
+    static constexpr bool bulk_release{false};
+    static constexpr bool is_always_equal{true};
+
+    NodeT* allocate()
+    {
+        return static_cast<NodeT*>(::operator new(sizeof(NodeT)));
+    }
+
+    void deallocate(NodeT* node) noexcept
+    {
+        ::operator delete(node);
+    }
+
+    // Nothing is held besides the nodes themselves.
+    void release() noexcept
+    {
+    }
+
+    [[nodiscard]]
+    NodeAllocatorStats stats() const noexcept
+    {
+        return NodeAllocatorStats{};
+    }
+};
+
+/**
+ * @brief Nodes are carved out of large slabs and recycled through a free
+ * list.
+ *
+ * @details A freed node is pushed onto an intrusive free list, its storage
+ * holding the link, and the next allocation pops it again. Only when the
+ * free list is empty is a new node taken from the newest slab, and only when
+ * that is used up is a new slab allocated. release() frees every slab at
+ * once, so a list doesn't have to give back its nodes one by one.
+ *
+ * Each instance owns its slabs, so it can't be copied, and nodes must go
+ * back to the instance they came from.
+ *
+ * @tparam NodeT The type of the nodes.
+ * @tparam SlabNodes Number of nodes per slab.
+ */
+template <typename NodeT, std::size_t SlabNodes = SLAB_NODE_COUNT>
+class SlabNodeAllocator
+{
+    static_assert(SlabNodes > 0, "Slabs can't be empty.");
+
+public:
+    static constexpr bool bulk_release{true};
+    static constexpr bool is_always_equal{false};
+
+private:
+    // Storage for a node, or the link to the next free one.
+    union Slot
+    {
+        Slot* next;
+        alignas(NodeT) std::byte storage[sizeof(NodeT)];
+    };
+
+    struct Slab
+    {
+        Slab* next; // Slab allocated before this one.
+        Slot  slots[SlabNodes];
+    };
+
+    Slab*       m_slabs{nullptr}; // Newest slab first.
+    Slot*       m_free{nullptr};  // Freed nodes, last freed first.
+    std::size_t m_used{SlabNodes}; // Slots of the newest slab handed out.
+
+    NodeAllocatorStats m_stats{};
+
+public:
+    // Default constructor.
+    SlabNodeAllocator() = default;
+
+    SlabNodeAllocator(const SlabNodeAllocator&)            = delete;
+    SlabNodeAllocator& operator=(const SlabNodeAllocator&) = delete;
+
+    // Move constructor. The slabs change owner.
+    SlabNodeAllocator(SlabNodeAllocator&& other) noexcept
+        : m_slabs{std::exchange(other.m_slabs, nullptr)},
+          m_free{std::exchange(other.m_free, nullptr)},
+          m_used{std::exchange(other.m_used, SlabNodes)},
+          m_stats{std::exchange(other.m_stats, NodeAllocatorStats{})}
+    {
+    }
+
+    // Move assignment operator. The own slabs must be unused.
+    SlabNodeAllocator& operator=(SlabNodeAllocator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            m_slabs = std::exchange(other.m_slabs, nullptr);
+            m_free  = std::exchange(other.m_free, nullptr);
+            m_used  = std::exchange(other.m_used, SlabNodes);
+            m_stats = std::exchange(other.m_stats, NodeAllocatorStats{});
+        }
+        return *this;
+    }
+
+    ~SlabNodeAllocator()
+    {
+        release();
+    }
+
+    NodeT* allocate()
+    {
+        Slot* slot{nullptr};
+
+        if (m_free != nullptr)
+        {
+            slot   = m_free;
+            m_free = slot->next;
+        }
+        else
+        {
+            if (m_used == SlabNodes)
+            {
+                // Default-initialized, the slots are left as raw storage.
+                auto* slab = new Slab;
+                slab->next = m_slabs;
+                m_slabs    = slab;
+                m_used     = 0;
+
+                m_stats.bytes += sizeof(Slab);
+                m_stats.peak_bytes = std::max(m_stats.peak_bytes, m_stats.bytes);
+            }
+            slot = &m_slabs->slots[m_used++];
+        }
+
+        ++m_stats.allocations;
+        return reinterpret_cast<NodeT*>(slot->storage);
+    }
+
+    void deallocate(NodeT* node) noexcept
+    {
+        auto* slot = reinterpret_cast<Slot*>(node);
+        slot->next = m_free;
+        m_free     = slot;
+
+        ++m_stats.deallocations;
+    }
+
+    // Free every slab. The nodes in them must be destroyed beforehand.
+    void release() noexcept
+    {
+        while (m_slabs != nullptr)
+        {
+            delete std::exchange(m_slabs, m_slabs->next);
+        }
+
+        m_free = nullptr;
+        m_used = SlabNodes;
+        m_stats.bytes = 0;
+    }
+
+    [[nodiscard]]
+    NodeAllocatorStats stats() const noexcept
+    {
+        return m_stats;
+    }
+};
+
+#endif // NODEALLOCATOR_HPP
@@ -0,0 +1,369 @@
+// An array of unsigned integers stored with a fixed number of bits each.
+#ifndef PACKEDARRAYLIST_HPP
+#define PACKEDARRAYLIST_HPP
+
+#include "ArrayList.hpp"
+
+#include <algorithm>        // std::max
+#include <bit>              // std::bit_width
+#include <concepts>         // std::unsigned_integral
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <cstdint>          // std::uint64_t
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <iterator>         // std::random_access_iterator_tag
+#include <limits>           // std::numeric_limits
+#include <ranges>           // std::ranges::forward_range
+#include <stdexcept>        // std::out_of_range, std::invalid_argument
+
+/**
+ * @brief A list of unsigned integers that uses only "bits" bits per item.
+ *
+ * @details Items are laid out back to back in 64-bit words, an item may
+ * straddle two words. Reading an item is O(1): one or two word loads, a
+ * shift and a mask. A zero word is always kept past the last item, so the
+ * read needs no branch and bulk decoding can be vectorized by the compiler.
+ *
+ * Since items aren't addressable, operator[] returns by value and the class
+ * doesn't implement List<T>. Use set() to change an item.
+ *
+ * PackedArrayList<>{17} holds the item 17, an empty list of 17-bit items is
+ * PackedArrayList<>::with_bits(17).
+ *
+ * @tparam T The unsigned integer type handed in and out.
+ */
+template <std::unsigned_integral T = std::uint64_t>
+class PackedArrayList
+{
+public:
+    using value_type = T;
+    using size_type  = std::size_t;
+
+private:
+    static constexpr unsigned WORD_BITS{64};
+
+    ArrayList<std::uint64_t> m_words{0}; // Packed items and the zero word.
+    size_type                m_size{};   // Current number of list elements.
+    unsigned                 m_bits{};   // Bits per item.
+    std::uint64_t            m_mask{};   // The lowest m_bits bits set.
+
+    static std::uint64_t mask_for(const unsigned bits) noexcept
+    {
+        return bits == WORD_BITS ? ~std::uint64_t{} : (std::uint64_t{1} << bits) - 1;
+    }
+
+    // Read the item that starts at bit "bit", without bounds checks.
+    std::uint64_t load(const size_type bit) const noexcept
+    {
+        const std::uint64_t* words = m_words.data();
+
+        const size_type word{bit / WORD_BITS};
+        const unsigned  shift{static_cast<unsigned>(bit % WORD_BITS)};
+
+        // The high part comes from the next word. Shifting in two steps keeps
+        // the shift below 64 even when "shift" is 0, there is no branch.
+        const std::uint64_t low  = words[word] >> shift;
+        const std::uint64_t high = (words[word + 1] << 1) << (WORD_BITS - 1 - shift);
+
+        return (low | high) & m_mask;
+    }
+
+    // Overwrite the item that starts at bit "bit". Its words must exist.
+    void store(const size_type bit, const std::uint64_t value) noexcept
+    {
+        std::uint64_t* words = m_words.data();
+
+        const size_type word{bit / WORD_BITS};
+        const unsigned  shift{static_cast<unsigned>(bit % WORD_BITS)};
+
+        words[word] = (words[word] & ~(m_mask << shift)) | (value << shift);
+
+        if (shift + m_bits > WORD_BITS)
+        {
+            const unsigned spill{WORD_BITS - shift}; // Bits in the first word.
+            words[word + 1] = (words[word + 1] & ~(m_mask >> spill)) | (value >> spill);
+        }
+    }
+
+    void check_fits(const value_type value) const
+    {
+        if ((static_cast<std::uint64_t>(value) & ~m_mask) != 0)
+        {
+            throw std::out_of_range{"Value doesn't fit in the bit width."};
+        }
+    }
+
+    // An empty list storing "bits" bits per item. Private, so brace
+    // initialization always means the items, see with_bits().
+    explicit PackedArrayList(const unsigned bits)
+        : m_bits{bits}, m_mask{mask_for(bits)}
+    {
+        if (bits == 0 || bits > static_cast<unsigned>(std::numeric_limits<T>::digits))
+        {
+            throw std::invalid_argument{"Bit width out of range."};
+        }
+    }
+
+public:
+    // Iterator that decodes items on the fly. Items are read-only.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept  = std::random_access_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = T;
+        using reference         = T; // Items are decoded, not referenced.
+
+        const_iterator() = default;
+
+        const_iterator(const PackedArrayList* list, const size_type index)
+            : m_list{list}, m_index{index}
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*m_list)[m_index];
+        }
+
+        reference operator[](const difference_type n) const
+        {
+            return (*m_list)[m_index + static_cast<size_type>(n)];
+        }
+
+        const_iterator& operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator temp{*this};
+            ++m_index;
+            return temp;
+        }
+
+        const_iterator& operator--()
+        {
+            --m_index;
+            return *this;
+        }
+
+        const_iterator operator--(int)
+        {
+            const_iterator temp{*this};
+            --m_index;
+            return temp;
+        }
+
+        const_iterator& operator+=(const difference_type n)
+        {
+            m_index += static_cast<size_type>(n);
+            return *this;
+        }
+
+        const_iterator& operator-=(const difference_type n)
+        {
+            m_index -= static_cast<size_type>(n);
+            return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, const difference_type n)
+        {
+            return it += n;
+        }
+
+        friend const_iterator operator+(const difference_type n, const_iterator it)
+        {
+            return it += n;
+        }
+
+        friend const_iterator operator-(const_iterator it, const difference_type n)
+        {
+            return it -= n;
+        }
+
+        friend difference_type operator-(const const_iterator& it1, const const_iterator& it2)
+        {
+            return static_cast<difference_type>(it1.m_index) -
+                   static_cast<difference_type>(it2.m_index);
+        }
+
+        friend bool operator==(const const_iterator& it1, const const_iterator& it2)
+        {
+            return it1.m_index == it2.m_index;
+        }
+
+        friend auto operator<=>(const const_iterator& it1, const const_iterator& it2)
+        {
+            return it1.m_index <=> it2.m_index;
+        }
+
+    private:
+        const PackedArrayList* m_list{nullptr};
+        size_type              m_index{};
+    };
+
+    // Number of bits it takes to store "max_value", at least 1.
+    static unsigned bits_needed(const value_type max_value) noexcept
+    {
+        return std::max(1U, static_cast<unsigned>(std::bit_width(max_value)));
+    }
+
+    // An empty list using every bit of T per item, which packs nothing.
+    // Use with_bits() to pick a width.
+    PackedArrayList()
+        : PackedArrayList(static_cast<unsigned>(std::numeric_limits<T>::digits))
+    {
+    }
+
+    // An empty list storing "bits" bits per item. Throws
+    // std::invalid_argument if "bits" is 0 or wider than T.
+    [[nodiscard]]
+    static PackedArrayList with_bits(const unsigned bits)
+    {
+        return PackedArrayList(bits);
+    }
+
+    // Pack the items of "range" with the fewest bits that hold them all.
+    template <std::ranges::forward_range R>
+        requires std::convertible_to<std::ranges::range_value_t<R>, T>
+    explicit PackedArrayList(const R& range)
+        : PackedArrayList(bits_needed(std::ranges::empty(range)
+                                          ? value_type{}
+                                          : std::ranges::max(range)))
+    {
+        reserve(static_cast<size_type>(std::ranges::distance(range)));
+        for (const auto item : range)
+        {
+            append(item);
+        }
+    }
+
+    PackedArrayList(const std::initializer_list<value_type> i_list)
+        : PackedArrayList(std::ranges::subrange(i_list.begin(), i_list.end()))
+    {
+    }
+
+    // Make room for "count" items without growing.
+    void reserve(const size_type count)
+    {
+        m_words.reserve((count * m_bits + WORD_BITS - 1) / WORD_BITS + 1);
+    }
+
+    // Append "value". Throws if it doesn't fit in bit_width() bits.
+    void append(const value_type value)
+    {
+        check_fits(value);
+
+        const size_type bit{m_size * m_bits};
+
+        // Keep a zero word past the last item.
+        while (m_words.size() * WORD_BITS < bit + m_bits + WORD_BITS)
+        {
+            m_words.append(0);
+        }
+
+        store(bit, value);
+        ++m_size;
+    }
+
+    // Overwrite the item at "pos".
+    void set(const size_type pos, const value_type value)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        check_fits(value);
+
+        store(pos * m_bits, value);
+    }
+
+    // Return the item at "pos".
+    value_type operator[](const size_type pos) const noexcept
+    {
+        return static_cast<value_type>(load(pos * m_bits));
+    }
+
+    value_type at(const size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Decode "count" items starting at "first" into "out".
+    // A straight loop without branches, so it vectorizes.
+    void decode(const size_type first, const size_type count, value_type* out) const
+    {
+        if (first > m_size || count > m_size - first)
+        {
+            throw std::out_of_range{"Range out of range."};
+        }
+
+        for (size_type i{}; i < count; ++i)
+        {
+            out[i] = static_cast<value_type>(load((first + i) * m_bits));
+        }
+    }
+
+    void clear()
+    {
+        m_words.clear();
+        m_words.append(0);
+        m_size = 0;
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    // Bits used per item.
+    [[nodiscard]]
+    unsigned bit_width() const noexcept
+    {
+        return m_bits;
+    }
+
+    // Bytes taken by the packed words.
+    [[nodiscard]]
+    size_type memory_bytes() const noexcept
+    {
+        return m_words.capacity() * sizeof(std::uint64_t);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{this, 0};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{this, m_size};
+    }
+};
+
+template <std::unsigned_integral T>
+std::ostream& operator<<(std::ostream& os, const PackedArrayList<T>& list)
+{
+    for (const auto item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // PACKEDARRAYLIST_HPP
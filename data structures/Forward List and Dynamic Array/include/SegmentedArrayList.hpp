@@ -0,0 +1,353 @@
+// An array-based list made of blocks that never move.
+#ifndef SEGMENTEDARRAYLIST_HPP
+#define SEGMENTEDARRAYLIST_HPP
+
+#include "List.hpp"
+#include "SegmentedArrayListIterator.hpp"
+
+#include <algorithm>        // std::move, std::move_backward
+#include <cstddef>          // std::size_t, std::ptrdiff_t
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <memory>           // std::construct_at, std::destroy
+#include <new>              // ::operator new, std::align_val_t
+#include <stdexcept>        // std::out_of_range
+#include <utility>          // std::move, std::exchange
+
+constexpr std::size_t SEGMENT_BLOCK_SIZE{16};
+
+/**
+ * @brief A list that grows by adding blocks instead of reallocating.
+ *
+ * @details Block k holds BlockSize * 2^k elements, so the list doubles its
+ * capacity like ArrayList does, but existing elements are never copied to
+ * a new buffer. Growing costs only the new block, and element addresses stay
+ * valid across append. The block directory has a slot for every block the
+ * list can ever need, so indexing is O(1): a bit scan picks the block and
+ * the rest of the index is the offset in it.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam BlockSize The size of the first block, a power of two.
+ */
+template <typename T, std::size_t BlockSize = SEGMENT_BLOCK_SIZE>
+class SegmentedArrayList : public List<T>
+{
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = SegmentedArrayListIterator<value_type, BlockSize>;
+    using const_iterator  = SegmentedArrayListIterator<const value_type, BlockSize>;
+
+private:
+    using layout = SegmentLayout<BlockSize>;
+
+    // Block directory. Only the first m_block_count entries are allocated.
+    pointer   m_blocks[layout::max_blocks]{};
+    size_type m_block_count{}; // Number of allocated blocks.
+    size_type m_capacity{};    // Total size of the allocated blocks.
+    size_type m_size{};        // Current number of list elements.
+
+    // Raw storage for block number "block", nothing is constructed in it.
+    static pointer allocate(const size_type block)
+    {
+        return static_cast<pointer>(
+            ::operator new(layout::block_size(block) * sizeof(value_type),
+                           std::align_val_t{alignof(value_type)}));
+    }
+
+    static void deallocate(pointer ptr) noexcept
+    {
+        ::operator delete(ptr, std::align_val_t{alignof(value_type)});
+    }
+
+    // Add the next block. Nothing already stored is touched.
+    void add_block()
+    {
+        m_blocks[m_block_count] = allocate(m_block_count);
+        m_capacity += layout::block_size(m_block_count);
+        ++m_block_count;
+    }
+
+    // Raw slot at "pos", which must be below m_capacity.
+    pointer slot(const size_type pos) const noexcept
+    {
+        return m_blocks[layout::block_of(pos)] + layout::offset_of(pos);
+    }
+
+    // Destroy the elements and free the blocks.
+    void release() noexcept
+    {
+        for (size_type i{}; i < m_size; ++i)
+        {
+            std::destroy_at(slot(i));
+        }
+
+        for (size_type block{}; block < m_block_count; ++block)
+        {
+            deallocate(m_blocks[block]);
+            m_blocks[block] = nullptr;
+        }
+    }
+
+    // Take over the blocks of "other". This list must have none.
+    void steal(SegmentedArrayList& other) noexcept
+    {
+        for (size_type block{}; block < other.m_block_count; ++block)
+        {
+            m_blocks[block] = std::exchange(other.m_blocks[block], nullptr);
+        }
+
+        m_block_count = std::exchange(other.m_block_count, 0);
+        m_capacity    = std::exchange(other.m_capacity, 0);
+        m_size        = std::exchange(other.m_size, 0);
+    }
+
+public:
+    SegmentedArrayList() = default;
+
+    SegmentedArrayList(const size_type size, const_reference value = value_type{})
+    {
+        try
+        {
+            // SegmentedArrayList elements are initialized by value.
+            for (size_type i{}; i < size; ++i)
+            {
+                append(value);
+            }
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    SegmentedArrayList(const std::initializer_list<value_type> i_list)
+    {
+        try
+        {
+            for (const auto& item : i_list)
+            {
+                append(item);
+            }
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    // Copy constructor.
+    SegmentedArrayList(const SegmentedArrayList& other)
+        : List<value_type>{}
+    {
+        try
+        {
+            for (const auto& item : other)
+            {
+                append(item);
+            }
+        }
+        catch (...)
+        {
+            release();
+            throw;
+        }
+    }
+
+    // Copy assignment operator.
+    SegmentedArrayList& operator=(const SegmentedArrayList& other)
+    {
+        if (this != &other)
+        {
+            // Copy first, so a throwing copy leaves this list untouched.
+            SegmentedArrayList temp{other};
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    // Move constructor.
+    // The blocks change hands, the elements stay where they are.
+    SegmentedArrayList(SegmentedArrayList&& other) noexcept
+        : List<value_type>{}
+    {
+        steal(other);
+    }
+
+    // Move assignment operator.
+    SegmentedArrayList& operator=(SegmentedArrayList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear(); // Clean up.
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~SegmentedArrayList()
+    {
+        release();
+    }
+
+    void clear()
+    {
+        release();
+        m_block_count = 0;
+        m_capacity    = 0;
+        m_size        = 0;
+    }
+
+    // Return the number of elements the list can hold before adding a block.
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Insert "item" at given position.
+    // Elements after "pos" shift up by value, their slots don't move.
+    void insert(const size_type pos, const_reference item) final
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        // "item" may live in this list, take a copy before anything moves.
+        value_type temp{item};
+
+        if (m_size == m_capacity)
+        {
+            add_block();
+        }
+
+        if (pos == m_size)
+        {
+            std::construct_at(slot(m_size), std::move(temp));
+            m_size++;
+            return;
+        }
+
+        // The slot past the last element is raw storage, so the last element
+        // is constructed there, the rest is moved over live elements.
+        std::construct_at(slot(m_size), std::move(*slot(m_size - 1)));
+        m_size++;
+
+        std::move_backward(begin() + static_cast<std::ptrdiff_t>(pos),
+                           end() - 2,
+                           end() - 1);
+
+        *slot(pos) = std::move(temp); // Insert "item" at position "pos".
+    }
+
+    // Append "item". Never moves existing elements.
+    void append(const_reference item) final
+    {
+        if (m_size == m_capacity)
+        {
+            add_block();
+        }
+
+        std::construct_at(slot(m_size), item);
+        m_size++;
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        std::move(begin() + static_cast<std::ptrdiff_t>(pos) + 1,
+                  end(),
+                  begin() + static_cast<std::ptrdiff_t>(pos)); // Shift down.
+
+        --m_size;
+        std::destroy_at(slot(m_size)); // End the vacated slot.
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return size() == 0;
+    }
+
+    reference operator[](const size_type pos) final
+    {
+        return *slot(pos);
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        return *slot(pos);
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return *slot(pos);
+    }
+
+    // Return iterator at beginning of list.
+    iterator begin()
+    {
+        return iterator{m_blocks, 0};
+    }
+
+    // Return iterator past end of list.
+    iterator end()
+    {
+        return iterator{m_blocks, m_size};
+    }
+
+    // Const iterators. Same as the regular iterators but read-only.
+    const_iterator begin() const
+    {
+        return const_iterator{m_blocks, 0};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{m_blocks, m_size};
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+};
+
+template <typename T, std::size_t BlockSize>
+std::ostream& operator<<(std::ostream&                            os,
+                         const SegmentedArrayList<T, BlockSize>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // SEGMENTEDARRAYLIST_HPP
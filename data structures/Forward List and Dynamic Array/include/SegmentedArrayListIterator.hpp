@@ -0,0 +1,188 @@
+// This is an iterator class for convenient use of STL algorithms.
+#ifndef SEGMENTEDARRAYLISTITERATOR_HPP
+#define SEGMENTEDARRAYLISTITERATOR_HPP
+
+#include <bit>         // std::bit_width, std::has_single_bit
+#include <cstddef>     // std::ptrdiff_t, std::size_t
+#include <iterator>    // std::random_access_iterator_tag
+#include <type_traits> // std::remove_cv_t, std::is_const_v, std::is_same_v
+
+/**
+ * @brief Where an index lives in a SegmentedArrayList.
+ *
+ * @details Block k holds BlockSize * 2^k elements, so the first k blocks hold
+ * BlockSize * (2^k - 1) elements together. Adding BlockSize to an index
+ * makes its highest bit tell the block, and the rest the offset in it.
+ */
+template <std::size_t BlockSize>
+struct SegmentLayout
+{
+    static_assert(std::has_single_bit(BlockSize),
+                  "Block size must be a power of two.");
+
+    static constexpr std::size_t base_bits{std::bit_width(BlockSize) - 1};
+
+    // Number of blocks it takes to address every std::size_t index.
+    static constexpr std::size_t max_blocks{sizeof(std::size_t) * 8 -
+                                            base_bits};
+
+    static constexpr std::size_t block_of(const std::size_t index) noexcept
+    {
+        return std::bit_width(index + BlockSize) - 1 - base_bits;
+    }
+
+    static constexpr std::size_t offset_of(const std::size_t index) noexcept
+    {
+        return index + BlockSize - (BlockSize << block_of(index));
+    }
+
+    static constexpr std::size_t block_size(const std::size_t block) noexcept
+    {
+        return BlockSize << block;
+    }
+};
+
+// This class is used in order to be compliant with the STL algorithms.
+// It keeps an index into the block directory rather than a pointer, so it
+// can step across block boundaries in O(1).
+// SegmentedArrayListIterator<const T, BlockSize> is the const_iterator.
+template <typename T, std::size_t BlockSize>
+class SegmentedArrayListIterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_cv_t<T>;
+    using pointer           = T*;
+    using reference         = T&;
+
+private:
+    using layout = SegmentLayout<BlockSize>;
+
+    // The const_iterator reads the members of the iterator it converts from.
+    template <typename U, std::size_t>
+    friend class SegmentedArrayListIterator;
+
+    pointer const* m_blocks{nullptr}; // Block directory of the list.
+    std::size_t    m_index{};         // Current position.
+
+public:
+    // Default constructor.
+    SegmentedArrayListIterator() = default;
+
+    // Constructor with the directory of a list and a position in it.
+    SegmentedArrayListIterator(pointer const* blocks, const std::size_t index)
+        : m_blocks{blocks}, m_index{index}
+    {
+    }
+
+    // An iterator converts to a const_iterator, but not the other way.
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    SegmentedArrayListIterator(const SegmentedArrayListIterator<U, BlockSize>& other)
+        : m_blocks{other.m_blocks}, m_index{other.m_index}
+    {
+    }
+
+    // To move one position forward. (Pre-increment)
+    SegmentedArrayListIterator& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+
+    // To move one position backward. (Pre-decrement)
+    SegmentedArrayListIterator& operator--()
+    {
+        --m_index;
+        return *this;
+    }
+
+    // To move one position forward. (Post-increment)
+    SegmentedArrayListIterator operator++(int)
+    {
+        SegmentedArrayListIterator temp{*this}; // Save the current position.
+        ++m_index;
+        return temp;
+    }
+
+    // To move one position backward. (Post-decrement)
+    SegmentedArrayListIterator operator--(int)
+    {
+        SegmentedArrayListIterator temp{*this}; // Save the current position.
+        --m_index;
+        return temp;
+    }
+
+    // To get the value at the current iterator position.
+    reference operator*() const
+    {
+        return m_blocks[layout::block_of(m_index)][layout::offset_of(m_index)];
+    }
+
+    // To point at the current iterator position.
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    // To get the value at a certain position.
+    reference operator[](const difference_type n) const
+    {
+        return *(*this + n);
+    }
+
+    // To move the iterator forward by a certain amount.
+    SegmentedArrayListIterator& operator+=(const difference_type n)
+    {
+        m_index += static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    // To move the iterator backward by a certain amount.
+    SegmentedArrayListIterator& operator-=(const difference_type n)
+    {
+        m_index -= static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    friend SegmentedArrayListIterator operator+(SegmentedArrayListIterator it,
+                                                const difference_type      n)
+    {
+        return it += n;
+    }
+
+    friend SegmentedArrayListIterator operator+(const difference_type      n,
+                                                SegmentedArrayListIterator it)
+    {
+        return it += n;
+    }
+
+    friend SegmentedArrayListIterator operator-(SegmentedArrayListIterator it,
+                                                const difference_type      n)
+    {
+        return it -= n;
+    }
+
+    // To get the distance between two iterators.
+    friend difference_type operator-(const SegmentedArrayListIterator& it1,
+                                     const SegmentedArrayListIterator& it2)
+    {
+        return static_cast<difference_type>(it1.m_index) -
+               static_cast<difference_type>(it2.m_index);
+    }
+
+    // To compare iterators.
+    friend bool operator==(const SegmentedArrayListIterator& it1,
+                           const SegmentedArrayListIterator& it2)
+    {
+        return it1.m_index == it2.m_index;
+    }
+
+    friend auto operator<=>(const SegmentedArrayListIterator& it1,
+                            const SegmentedArrayListIterator& it2)
+    {
+        return it1.m_index <=> it2.m_index;
+    }
+};
+#endif // SEGMENTEDARRAYLISTITERATOR_HPP
@@ -0,0 +1,274 @@
+// A container of values that are referred to by stable handles.
+#ifndef SLOTMAP_HPP
+#define SLOTMAP_HPP
+
+#include "ArrayList.hpp"
+
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint32_t
+#include <limits>    // std::numeric_limits
+#include <stdexcept> // std::out_of_range, std::length_error
+#include <utility>   // std::move, std::forward
+
+// Refers to a value in a SlotMap. Stays the same while the value lives,
+// no matter what else is inserted or erased.
+struct SlotHandle
+{
+    std::uint32_t index{};      // Slot the value is registered in.
+    std::uint32_t generation{}; // Which use of the slot this handle is for.
+
+    friend bool operator==(const SlotHandle&, const SlotHandle&) = default;
+};
+
+/**
+ * @brief Values stored densely in an ArrayList, reachable through handles.
+ *
+ * @details Every value gets a slot that knows where the value is in the
+ * dense array. Erasing moves the last value into the hole, so the values
+ * are always packed and iterating them is iterating an ArrayList. Freed
+ * slots are chained into a free list and reused by later inserts. Each
+ * reuse bumps the slot's generation, so a handle to an erased value is
+ * detected instead of silently reaching the new one.
+ *
+ * Insert, erase and lookup are O(1). The order of the values is not kept.
+ *
+ * @tparam T The type of the values.
+ */
+template <typename T>
+class SlotMap
+{
+public:
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = typename ArrayList<value_type>::iterator;
+    using const_iterator  = typename ArrayList<value_type>::const_iterator;
+
+private:
+    // Marks the end of the free list.
+    static constexpr std::uint32_t NO_SLOT{
+        std::numeric_limits<std::uint32_t>::max()};
+
+    struct Slot
+    {
+        // Position of the value in m_values while the slot is used,
+        // the next free slot while it isn't.
+        std::uint32_t target{};
+        std::uint32_t generation{};
+    };
+
+    ArrayList<value_type>    m_values; // Live values, packed.
+    ArrayList<std::uint32_t> m_owners; // Slot of each value in m_values.
+    ArrayList<Slot>          m_slots;  // Handle index -> value position.
+
+    std::uint32_t m_free_head{NO_SLOT}; // First free slot.
+
+    // Slot of "handle" if the handle is still valid, otherwise nullptr.
+    const Slot* find_slot(const SlotHandle handle) const noexcept
+    {
+        if (handle.index >= m_slots.size())
+        {
+            return nullptr;
+        }
+
+        const Slot& slot = m_slots[handle.index];
+        return slot.generation == handle.generation ? &slot : nullptr;
+    }
+
+    // Take a slot for the value about to be put at the end of m_values.
+    SlotHandle acquire_slot()
+    {
+        const auto target = static_cast<std::uint32_t>(m_values.size());
+
+        if (m_free_head != NO_SLOT)
+        {
+            const std::uint32_t index{m_free_head};
+            Slot&               slot = m_slots[index];
+
+            m_free_head = slot.target; // Unlink it from the free list.
+            slot.target = target;
+            return SlotHandle{index, slot.generation};
+        }
+
+        if (m_slots.size() >= NO_SLOT)
+        {
+            throw std::length_error{"SlotMap is full."};
+        }
+
+        const auto index = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.append(Slot{target, 0});
+        return SlotHandle{index, 0};
+    }
+
+    // Give the slot back. Its handles go stale.
+    void release_slot(const std::uint32_t index) noexcept
+    {
+        Slot& slot = m_slots[index];
+        ++slot.generation;
+        slot.target = m_free_head;
+        m_free_head = index;
+    }
+
+public:
+    SlotMap() = default;
+
+    // Construct a value from "args" and return its handle.
+    template <typename... Args>
+    SlotHandle emplace(Args&&... args)
+    {
+        const SlotHandle handle = acquire_slot();
+
+        try
+        {
+            m_values.emplace_back(std::forward<Args>(args)...);
+            m_owners.append(handle.index);
+        }
+        catch (...)
+        {
+            if (m_values.size() > m_owners.size())
+            {
+                m_values.remove(m_values.size() - 1);
+            }
+            release_slot(handle.index);
+            throw;
+        }
+
+        return handle;
+    }
+
+    SlotHandle insert(const_reference value)
+    {
+        return emplace(value);
+    }
+
+    SlotHandle insert(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    // Erase the value of "handle". Return false if the handle is stale.
+    bool erase(const SlotHandle handle)
+    {
+        const Slot* slot = find_slot(handle);
+        if (slot == nullptr)
+        {
+            return false;
+        }
+
+        const std::uint32_t hole{slot->target};
+        const size_type     last{m_values.size() - 1};
+
+        // Fill the hole with the last value, so the values stay packed.
+        if (hole != last)
+        {
+            m_values[hole] = std::move(m_values[last]);
+            m_owners[hole] = m_owners[last];
+            m_slots[m_owners[hole]].target = hole;
+        }
+
+        m_values.remove(last); // Removing the last one doesn't shift.
+        m_owners.remove(last);
+        release_slot(handle.index);
+
+        return true;
+    }
+
+    // Whether "handle" still refers to a value.
+    [[nodiscard]]
+    bool contains(const SlotHandle handle) const noexcept
+    {
+        return find_slot(handle) != nullptr;
+    }
+
+    // Return pointer to the value of "handle", or nullptr if it is stale.
+    // The pointer is invalidated by the next insert or erase, the handle isn't.
+    pointer get(const SlotHandle handle) noexcept
+    {
+        const Slot* slot = find_slot(handle);
+        return slot == nullptr ? nullptr : &m_values[slot->target];
+    }
+
+    const_pointer get(const SlotHandle handle) const noexcept
+    {
+        const Slot* slot = find_slot(handle);
+        return slot == nullptr ? nullptr : &m_values[slot->target];
+    }
+
+    reference at(const SlotHandle handle)
+    {
+        pointer value = get(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range{"Stale handle."};
+        }
+        return *value;
+    }
+
+    const_reference at(const SlotHandle handle) const
+    {
+        const_pointer value = get(handle);
+        if (value == nullptr)
+        {
+            throw std::out_of_range{"Stale handle."};
+        }
+        return *value;
+    }
+
+    // Handle of the value at "pos" in iteration order.
+    [[nodiscard]]
+    SlotHandle handle_at(const size_type pos) const
+    {
+        const std::uint32_t index{m_owners[pos]};
+        return SlotHandle{index, m_slots[index].generation};
+    }
+
+    // Erase every value. All handles go stale, the slots are kept for reuse.
+    void clear()
+    {
+        for (const auto index : m_owners)
+        {
+            release_slot(index);
+        }
+
+        m_values.clear();
+        m_owners.clear();
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_values.size();
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    // Values are visited in the dense array, in no particular order.
+    iterator begin()
+    {
+        return m_values.begin();
+    }
+
+    iterator end()
+    {
+        return m_values.end();
+    }
+
+    const_iterator begin() const
+    {
+        return m_values.begin();
+    }
+
+    const_iterator end() const
+    {
+        return m_values.end();
+    }
+};
+
+#endif // SLOTMAP_HPP
@@ -0,0 +1,416 @@
+// An array-based list that keeps its first N elements inside the object.
+// Only lists that outgrow N elements touch the heap.
+#ifndef SMALLARRAYLIST_HPP
+#define SMALLARRAYLIST_HPP
+
+#include "ArrayListIterator.hpp"
+#include "List.hpp"
+
+#include <algorithm>        // std::move, std::move_backward, std::max
+#include <cstddef>          // std::byte, std::size_t
+#include <cstring>          // std::memcpy
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <memory>           // std::uninitialized_*, std::destroy
+#include <new>              // ::operator new, std::align_val_t
+#include <stdexcept>        // std::out_of_range
+#include <type_traits>      // std::is_trivially_copyable_v
+#include <utility>          // std::move, std::exchange
+
+constexpr std::size_t SMALL_INLINE_SIZE{16};
+constexpr std::size_t SMALL_GROWTH_FACTOR{2};
+
+/**
+ * @brief An ArrayList with a small buffer optimization.
+ *
+ * @details Up to N elements are stored in a buffer inside the object, so
+ * short lists never allocate. Once the list grows past N elements, it spills
+ * into heap storage and grows geometrically from there on.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam N The number of items kept inline.
+ */
+template <typename T, std::size_t N = SMALL_INLINE_SIZE>
+class SmallArrayList : public List<T>
+{
+    static_assert(N > 0, "Inline capacity must be at least 1.");
+
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = ArrayListIterator<value_type>;
+    using const_iterator  = ArrayListIterator<const value_type>;
+
+private:
+    // Inline storage. Elements are constructed in it on demand.
+    alignas(value_type) std::byte m_buffer[N * sizeof(value_type)];
+
+    size_type m_capacity{N}; // Maximum size before growing.
+    size_type m_size{};      // Current number of list elements.
+    // Points either to m_buffer or to heap storage.
+    // Only [0, m_size) holds constructed elements.
+    pointer m_list_array{inline_data()};
+
+    pointer inline_data() noexcept
+    {
+        return reinterpret_cast<pointer>(m_buffer);
+    }
+
+    static pointer allocate(const size_type count)
+    {
+        return static_cast<pointer>(::operator new(
+            count * sizeof(value_type), std::align_val_t{alignof(value_type)}));
+    }
+
+    // Free the storage unless it is the inline buffer.
+    void deallocate() noexcept
+    {
+        if (!is_inline())
+        {
+            ::operator delete(m_list_array,
+                              std::align_val_t{alignof(value_type)});
+        }
+    }
+
+    // Move "count" live elements from "src" into raw "dest" and end the
+    // lifetime of the originals.
+    static void relocate(pointer src, const size_type count, pointer dest)
+    {
+        if constexpr (std::is_trivially_copyable_v<value_type>)
+        {
+            if (count != 0)
+            {
+                std::memcpy(dest, src, count * sizeof(value_type));
+            }
+        }
+        else
+        {
+            std::uninitialized_move(src, src + count, dest);
+            std::destroy(src, src + count);
+        }
+    }
+
+    // Make room for at least "new_capacity" elements on the heap.
+    void grow(const size_type new_capacity)
+    {
+        pointer temp = allocate(new_capacity);
+
+        try
+        {
+            relocate(m_list_array, m_size, temp);
+        }
+        catch (...)
+        {
+            ::operator delete(temp, std::align_val_t{alignof(value_type)});
+            throw;
+        }
+
+        deallocate();
+        m_list_array = temp;
+        m_capacity   = new_capacity;
+    }
+
+    void reserve()
+    {
+        grow(m_capacity * SMALL_GROWTH_FACTOR);
+    }
+
+    // Take the elements of "other", stealing its heap storage if it has one.
+    void steal(SmallArrayList& other)
+    {
+        if (other.is_inline())
+        {
+            // Inline elements can't change owner, move them one by one.
+            relocate(other.m_list_array, other.m_size, m_list_array);
+        }
+        else
+        {
+            m_list_array = std::exchange(other.m_list_array, other.inline_data());
+            m_capacity   = std::exchange(other.m_capacity, N);
+        }
+
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+public:
+    SmallArrayList() = default;
+
+    SmallArrayList(const size_type size, const_reference value = value_type{})
+    {
+        if (size > N)
+        {
+            m_list_array = allocate(size);
+            m_capacity   = size;
+        }
+
+        try
+        {
+            // SmallArrayList elements are initialized by value.
+            std::uninitialized_fill_n(m_list_array, size, value);
+        }
+        catch (...)
+        {
+            deallocate();
+            throw;
+        }
+
+        m_size = size;
+    }
+
+    SmallArrayList(const std::initializer_list<value_type> i_list)
+    {
+        if (i_list.size() > N)
+        {
+            m_list_array = allocate(i_list.size());
+            m_capacity   = i_list.size();
+        }
+
+        try
+        {
+            std::uninitialized_copy(i_list.begin(), i_list.end(), m_list_array);
+        }
+        catch (...)
+        {
+            deallocate();
+            throw;
+        }
+
+        m_size = i_list.size();
+    }
+
+    // Copy constructor.
+    SmallArrayList(const SmallArrayList& other)
+        : List<value_type>{}
+    {
+        if (other.m_size > N)
+        {
+            m_list_array = allocate(other.m_size);
+            m_capacity   = other.m_size;
+        }
+
+        try
+        {
+            std::uninitialized_copy(other.m_list_array,
+                                    other.m_list_array + other.m_size,
+                                    m_list_array);
+        }
+        catch (...)
+        {
+            deallocate();
+            throw;
+        }
+
+        m_size = other.m_size;
+    }
+
+    // Copy assignment operator.
+    SmallArrayList& operator=(const SmallArrayList& other)
+    {
+        if (this != &other)
+        {
+            // Copy first, so a throwing copy leaves this list untouched.
+            SmallArrayList temp{other};
+            *this = std::move(temp);
+        }
+        return *this;
+    }
+
+    // Move constructor.
+    // Only heap storage can be stolen, inline elements are moved one by one.
+    SmallArrayList(SmallArrayList&& other) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>)
+        : List<value_type>{}
+    {
+        steal(other);
+    }
+
+    // Move assignment operator.
+    SmallArrayList& operator=(SmallArrayList&& other) noexcept(
+        std::is_nothrow_move_constructible_v<value_type>)
+    {
+        if (this != &other)
+        {
+            clear(); // Clean up.
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~SmallArrayList()
+    {
+        std::destroy(m_list_array, m_list_array + m_size);
+        deallocate();
+    }
+
+    // Destroy all elements and go back to the inline buffer.
+    void clear()
+    {
+        std::destroy(m_list_array, m_list_array + m_size);
+        deallocate();
+        m_list_array = inline_data();
+        m_capacity   = N;
+        m_size       = 0;
+    }
+
+    // Whether the elements still live in the inline buffer.
+    [[nodiscard]]
+    bool is_inline() const noexcept
+    {
+        return m_list_array == reinterpret_cast<const value_type*>(m_buffer);
+    }
+
+    // Return the number of elements the list can hold before growing.
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        // "item" may live in this list, take a copy before anything moves.
+        value_type temp{item};
+
+        if (m_size == m_capacity)
+        {
+            reserve();
+        }
+
+        if (pos == m_size)
+        {
+            std::construct_at(m_list_array + m_size, std::move(temp));
+            m_size++;
+            return;
+        }
+
+        // Shift elements up to make room, see ArrayList::insert.
+        std::construct_at(m_list_array + m_size,
+                          std::move(m_list_array[m_size - 1]));
+        std::move_backward(m_list_array + pos,
+                           m_list_array + m_size - 1,
+                           m_list_array + m_size);
+
+        m_list_array[pos] = std::move(temp); // Insert "item" at position "pos".
+
+        m_size++;
+    }
+
+    // Append "item".
+    void append(const_reference item) final
+    {
+        if (m_size == m_capacity)
+        {
+            // "item" may live in this list, so copy it before growing.
+            value_type temp{item};
+            reserve();
+            std::construct_at(m_list_array + m_size, std::move(temp));
+        }
+        else
+        {
+            std::construct_at(m_list_array + m_size, item);
+        }
+
+        m_size++;
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        std::move(m_list_array + pos + 1,
+                  m_list_array + m_size,
+                  m_list_array + pos); // Shift elements down.
+
+        --m_size;
+        std::destroy_at(m_list_array + m_size);
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return size() == 0;
+    }
+
+    reference operator[](const size_type pos) final
+    {
+        return m_list_array[pos];
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        return m_list_array[pos];
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return m_list_array[pos];
+    }
+
+    // Return iterator at beginning of list.
+    iterator begin()
+    {
+        return iterator{m_list_array};
+    }
+
+    // Return iterator past end of list.
+    iterator end()
+    {
+        return iterator{m_list_array + m_size};
+    }
+
+    // Const iterators. Same as the regular iterators but read-only.
+    const_iterator begin() const
+    {
+        return const_iterator{m_list_array};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{m_list_array + m_size};
+    }
+
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator cend() const
+    {
+        return end();
+    }
+};
+
+template <typename T, std::size_t N>
+std::ostream& operator<<(std::ostream& os, const SmallArrayList<T, N>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+    return os;
+}
+
+#endif // SMALLARRAYLIST_HPP
@@ -0,0 +1,323 @@
+// A list of records stored field by field (struct of arrays).
+#ifndef SOAARRAYLIST_HPP
+#define SOAARRAYLIST_HPP
+
+#include "GrowthPolicy.hpp"
+
+#include <algorithm>   // std::max, std::move
+#include <cstddef>     // std::size_t
+#include <memory>      // std::uninitialized_move_n, std::destroy_n, std::construct_at
+#include <new>         // std::align_val_t
+#include <span>        // std::span
+#include <stdexcept>   // std::out_of_range
+#include <tuple>       // std::tuple, std::apply, std::get, std::tuple_element_t
+#include <type_traits> // std::is_nothrow_move_constructible_v
+#include <utility>     // std::exchange, std::forward, std::index_sequence, std::swap
+
+// Columns start on a cache line, which is also the widest vector load.
+constexpr std::size_t COLUMN_ALIGNMENT{64};
+
+/**
+ * @brief A list of records where every field lives in its own array.
+ *
+ * @details SoAArrayList<int, double, int> holds the same rows as
+ * ArrayList<Record> with Record{int, double, int}, but keeps all ids
+ * together, all prices together and so on. A scan over one field only reads
+ * that field's memory, and column<I>() gives it to the scan as a std::span.
+ *
+ * Since a row isn't an object, operator[] returns a tuple of references to
+ * its fields, which also works with structured bindings:
+ *
+ *     auto [id, price, qty] = list[i];
+ *
+ * @tparam Ts The types of the fields.
+ */
+template <typename... Ts>
+class SoAArrayList
+{
+    static_assert(sizeof...(Ts) > 0, "A row needs at least one field.");
+    static_assert((std::is_nothrow_move_constructible_v<Ts> && ...),
+                  "Fields are moved when the columns grow.");
+
+public:
+    using size_type       = std::size_t;
+    using reference       = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+
+    // Type of the field in column I.
+    template <std::size_t I>
+    using column_type = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+private:
+    using columns = std::tuple<Ts*...>;
+    using indices = std::index_sequence_for<Ts...>;
+
+    columns   m_columns{}; // One raw array per field.
+    size_type m_size{};     // Current number of rows.
+    size_type m_capacity{}; // Maximum number of rows.
+
+    template <typename U>
+    static constexpr std::align_val_t alignment{
+        std::max(COLUMN_ALIGNMENT, alignof(U))};
+
+    template <typename U>
+    static void allocate_column(U*& column, const size_type count)
+    {
+        column = static_cast<U*>(::operator new(count * sizeof(U), alignment<U>));
+    }
+
+    template <typename U>
+    static void deallocate_column(U* column) noexcept
+    {
+        if (column != nullptr)
+        {
+            ::operator delete(column, alignment<U>);
+        }
+    }
+
+    // Allocate every column with room for "count" rows.
+    static columns allocate(const size_type count)
+    {
+        columns result{};
+
+        try
+        {
+            std::apply([count](auto*&... column) { (allocate_column(column, count), ...); },
+                       result);
+        }
+        catch (...)
+        {
+            deallocate(result);
+            throw;
+        }
+
+        return result;
+    }
+
+    // Give the columns back. Rows must be destroyed beforehand.
+    static void deallocate(const columns& cols) noexcept
+    {
+        std::apply([](auto*... column) { (deallocate_column(column), ...); }, cols);
+    }
+
+    // Construct row "pos" of "cols" from "values". Fields constructed before
+    // a throwing one are destroyed again.
+    template <std::size_t... Is, typename... Us>
+    static void construct_row(std::index_sequence<Is...>,
+                              const columns& cols,
+                              const size_type pos,
+                              Us&&... values)
+    {
+        std::size_t done{};
+
+        try
+        {
+            ((std::construct_at(std::get<Is>(cols) + pos, std::forward<Us>(values)),
+              ++done),
+             ...);
+        }
+        catch (...)
+        {
+            ((Is < done ? std::destroy_at(std::get<Is>(cols) + pos) : void()), ...);
+            throw;
+        }
+    }
+
+    // Destroy the rows and free the columns.
+    void release() noexcept
+    {
+        std::apply([this](auto*... column) { (std::destroy_n(column, m_size), ...); },
+                   m_columns);
+        deallocate(m_columns);
+    }
+
+    // Move the rows into "cols", which has room for "capacity" rows.
+    void adopt(const columns& cols, const size_type capacity) noexcept
+    {
+        [&]<std::size_t... Is>(std::index_sequence<Is...>)
+        {
+            (std::uninitialized_move_n(std::get<Is>(m_columns), m_size, std::get<Is>(cols)),
+             ...);
+        }(indices{});
+
+        release();
+        m_columns  = cols;
+        m_capacity = capacity;
+    }
+
+public:
+    // Default constructor.
+    SoAArrayList() = default;
+
+    // Copy constructor.
+    SoAArrayList(const SoAArrayList& other)
+    {
+        reserve(other.m_size);
+        for (size_type i{}; i < other.m_size; ++i)
+        {
+            std::apply([this](const Ts&... fields) { append(fields...); }, other[i]);
+        }
+    }
+
+    // Move constructor.
+    SoAArrayList(SoAArrayList&& other) noexcept
+        : m_columns{std::exchange(other.m_columns, columns{})},
+          m_size{std::exchange(other.m_size, 0)},
+          m_capacity{std::exchange(other.m_capacity, 0)}
+    {
+    }
+
+    // Copy and move assignment operator.
+    SoAArrayList& operator=(SoAArrayList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor.
+    ~SoAArrayList()
+    {
+        release();
+    }
+
+    void swap(SoAArrayList& other) noexcept
+    {
+        std::swap(m_columns, other.m_columns);
+        std::swap(m_size, other.m_size);
+        std::swap(m_capacity, other.m_capacity);
+    }
+
+    // Make room for at least "new_capacity" rows.
+    void reserve(const size_type new_capacity)
+    {
+        if (new_capacity > m_capacity)
+        {
+            adopt(allocate(new_capacity), new_capacity);
+        }
+    }
+
+    // Append a row made of "values", one per field.
+    template <typename... Us>
+        requires(sizeof...(Us) == sizeof...(Ts))
+    void append(Us&&... values)
+    {
+        if (m_size < m_capacity)
+        {
+            construct_row(indices{}, m_columns, m_size, std::forward<Us>(values)...);
+        }
+        else
+        {
+            // Build the row in the new columns first, "values" may refer to
+            // fields of this list.
+            const size_type new_capacity{DoublingGrowth::grow(m_capacity, m_size + 1)};
+            const columns   grown = allocate(new_capacity);
+
+            try
+            {
+                construct_row(indices{}, grown, m_size, std::forward<Us>(values)...);
+            }
+            catch (...)
+            {
+                deallocate(grown);
+                throw;
+            }
+
+            adopt(grown, new_capacity);
+        }
+
+        ++m_size;
+    }
+
+    // Remove the row at given position.
+    void remove(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        std::apply(
+            [this, pos](auto*... column)
+            {
+                ((std::move(column + pos + 1, column + m_size, column + pos),
+                  std::destroy_at(column + m_size - 1)),
+                 ...);
+            },
+            m_columns);
+
+        --m_size;
+    }
+
+    // Destroy every row, keeping the capacity.
+    void clear() noexcept
+    {
+        std::apply([this](auto*... column) { (std::destroy_n(column, m_size), ...); },
+                   m_columns);
+        m_size = 0;
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    // Return the fields of the row at "pos".
+    reference operator[](const size_type pos) noexcept
+    {
+        return std::apply([pos](auto*... column) { return reference{column[pos]...}; },
+                          m_columns);
+    }
+
+    const_reference operator[](const size_type pos) const noexcept
+    {
+        return std::apply([pos](auto*... column) { return const_reference{column[pos]...}; },
+                          m_columns);
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(const size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Return the I-th field of every row. The data is aligned to
+    // COLUMN_ALIGNMENT bytes.
+    template <std::size_t I>
+    std::span<column_type<I>> column() noexcept
+    {
+        return {std::get<I>(m_columns), m_size};
+    }
+
+    template <std::size_t I>
+    std::span<const column_type<I>> column() const noexcept
+    {
+        return {std::get<I>(m_columns), m_size};
+    }
+};
+
+#endif // SOAARRAYLIST_HPP
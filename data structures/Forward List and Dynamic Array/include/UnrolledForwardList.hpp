@@ -0,0 +1,414 @@
+// A singly linked list that keeps several items in each node.
+#ifndef UNROLLEDFORWARDLIST_HPP
+#define UNROLLEDFORWARDLIST_HPP
+
+#include "List.hpp"
+#include "UnrolledForwardListIterator.hpp"
+#include "UnrolledNode.hpp"
+
+#include <algorithm>        // std::move, std::move_backward
+#include <cstddef>          // std::size_t
+#include <initializer_list> // std::initializer_list
+#include <iostream>         // operator<<
+#include <memory>           // std::construct_at, std::destroy_at, std::destroy_n, std::uninitialized_move_n
+#include <stdexcept>        // std::out_of_range
+#include <utility>          // std::move, std::exchange, std::swap
+
+// Default number of items per node.
+constexpr std::size_t UNROLLED_NODE_SIZE{16};
+
+/**
+ * @brief A singly linked list of small arrays.
+ *
+ * @details Every node holds up to K items next to each other, so walking
+ * the list follows one pointer per K items instead of one per item, and
+ * the pointer overhead is shared by K items. A full node is split in half
+ * on insert. A node that drops below half full on remove is merged with the
+ * next one when they fit together, and borrows the next one's first item
+ * otherwise. So every node but the last stays at least half full.
+ *
+ * @tparam T The type of the items in the list.
+ * @tparam K Maximum number of items per node.
+ */
+template <typename T, std::size_t K = UNROLLED_NODE_SIZE>
+class UnrolledForwardList : public List<T>
+{
+    static_assert(K >= 2, "A node must hold at least two items to be split.");
+
+public:
+    using value_type      = typename List<T>::value_type;
+    using size_type       = typename List<T>::size_type;
+    using reference       = typename List<T>::reference;
+    using const_reference = typename List<T>::const_reference;
+    using pointer         = typename List<T>::pointer;
+    using iterator        = UnrolledForwardListIterator<value_type, K>;
+    using const_iterator  = UnrolledForwardListIterator<const value_type, K>;
+
+private:
+    using node_type = UnrolledNode<value_type, K>;
+
+    node_type* m_head{nullptr};
+    node_type* m_tail{nullptr};
+
+    size_type m_size{}; // Current number of list elements.
+
+    // Find the node holding the item at "pos" and the item's position in it.
+    // "pos" must be less than m_size.
+    node_type* locate(size_type& pos) const noexcept
+    {
+        node_type* node = m_head;
+
+        // Skip whole nodes.
+        while (pos >= node->count)
+        {
+            pos -= node->count;
+            node = node->next;
+        }
+        return node;
+    }
+
+    // Move the upper half of "node" to a new node after it.
+    void split(node_type* node)
+    {
+        auto* upper = new node_type;
+
+        const size_type half{node->count / 2};
+        const size_type moved{node->count - half};
+
+        try
+        {
+            std::uninitialized_move_n(node->items() + half, moved, upper->items());
+        }
+        catch (...)
+        {
+            delete upper; // Not linked yet.
+            throw;
+        }
+        std::destroy_n(node->items() + half, moved);
+
+        upper->count = moved;
+        node->count  = half;
+
+        upper->next = node->next;
+        node->next  = upper;
+
+        if (node == m_tail)
+        {
+            m_tail = upper;
+        }
+    }
+
+    // Move the items of the node after "node" into it and drop that node.
+    void merge_next(node_type* node) noexcept
+    {
+        node_type* next = node->next;
+
+        std::uninitialized_move_n(next->items(), next->count, node->items() + node->count);
+        std::destroy_n(next->items(), next->count);
+
+        node->count += next->count;
+        node->next = next->next;
+
+        if (next == m_tail)
+        {
+            m_tail = node;
+        }
+        delete next;
+    }
+
+    // Move the first item of the node after "node" to the end of "node".
+    void borrow_next(node_type* node)
+    {
+        node_type*  next  = node->next;
+        value_type* items = next->items();
+
+        std::construct_at(node->items() + node->count, std::move(items[0]));
+        ++node->count;
+
+        std::move(items + 1, items + next->count, items); // Shift down.
+        std::destroy_at(items + next->count - 1);
+        --next->count;
+    }
+
+public:
+    // Default constructor.
+    UnrolledForwardList() = default;
+
+    // Constructor with initializer list.
+    UnrolledForwardList(const std::initializer_list<value_type> i_list)
+    {
+        for (const auto& item : i_list)
+        {
+            append(item);
+        }
+    }
+
+    // Copy constructor.
+    UnrolledForwardList(const UnrolledForwardList& other)
+        : List<value_type>{}
+    {
+        for (const auto& item : other)
+        {
+            append(item);
+        }
+    }
+
+    // Move constructor.
+    UnrolledForwardList(UnrolledForwardList&& other) noexcept
+        : m_head{std::exchange(other.m_head, nullptr)},
+          m_tail{std::exchange(other.m_tail, nullptr)},
+          m_size{std::exchange(other.m_size, 0)}
+    {
+    }
+
+    // Copy and move assignment operator.
+    UnrolledForwardList& operator=(UnrolledForwardList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    // Destructor.
+    ~UnrolledForwardList()
+    {
+        clear();
+    }
+
+    void swap(UnrolledForwardList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_size, other.m_size);
+    }
+
+    // Delete every node.
+    void clear() noexcept
+    {
+        while (m_head != nullptr)
+        {
+            node_type* node = std::exchange(m_head, m_head->next);
+            std::destroy_n(node->items(), node->count);
+            delete node;
+        }
+
+        m_tail = nullptr;
+        m_size = 0;
+    }
+
+    // Append "item".
+    void append(const_reference item) final
+    {
+        if (m_tail == nullptr || m_tail->count == K)
+        {
+            // Fill the new node before linking it, the list never has an
+            // empty node.
+            auto* node = new node_type;
+
+            try
+            {
+                std::construct_at(node->items(), item);
+            }
+            catch (...)
+            {
+                delete node;
+                throw;
+            }
+            node->count = 1;
+
+            if (m_tail == nullptr)
+            {
+                m_head = node;
+            }
+            else
+            {
+                m_tail->next = node;
+            }
+            m_tail = node;
+        }
+        else
+        {
+            std::construct_at(m_tail->items() + m_tail->count, item);
+            ++m_tail->count;
+        }
+
+        ++m_size;
+    }
+
+    // Insert "item" at given position.
+    void insert(const size_type pos, const_reference item) final
+    {
+        if (pos > m_size)
+        {
+            throw std::out_of_range{"Position out of range."};
+        }
+
+        if (pos == m_size)
+        {
+            append(item);
+            return;
+        }
+
+        // "item" may live in the node that is about to be shifted.
+        value_type temp{item};
+
+        size_type  offset{pos};
+        node_type* node = locate(offset);
+
+        if (node->count == K)
+        {
+            split(node);
+
+            if (offset > node->count)
+            {
+                offset -= node->count;
+                node = node->next;
+            }
+        }
+
+        value_type*     items = node->items();
+        const size_type count{node->count};
+
+        if (offset == count)
+        {
+            std::construct_at(items + count, std::move(temp));
+        }
+        else
+        {
+            // Shift the items after "offset" one to the right.
+            std::construct_at(items + count, std::move(items[count - 1]));
+            std::move_backward(items + offset, items + count - 1, items + count);
+            items[offset] = std::move(temp);
+        }
+
+        ++node->count;
+        ++m_size;
+    }
+
+    // Remove the element at given position.
+    void remove(const size_type pos) final
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"No element at position."};
+        }
+
+        // Find the node with its predecessor, an emptied node is unlinked.
+        node_type* prev = nullptr;
+        node_type* node = m_head;
+        size_type  offset{pos};
+
+        while (offset >= node->count)
+        {
+            offset -= node->count;
+            prev = node;
+            node = node->next;
+        }
+
+        value_type* items = node->items();
+        std::move(items + offset + 1, items + node->count, items + offset); // Shift down.
+        std::destroy_at(items + node->count - 1);
+
+        --node->count;
+        --m_size;
+
+        if (node->count == 0)
+        {
+            (prev == nullptr ? m_head : prev->next) = node->next;
+
+            if (node == m_tail)
+            {
+                m_tail = prev;
+            }
+            delete node;
+        }
+        else if (node->count < K / 2 && node->next != nullptr)
+        {
+            if (node->count + node->next->count <= K)
+            {
+                merge_next(node);
+            }
+            else
+            {
+                borrow_next(node);
+            }
+        }
+    }
+
+    // Return list size.
+    size_type size() const final
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const final
+    {
+        return m_size == 0;
+    }
+
+    // Skips K items per step.
+    reference operator[](const size_type pos) final
+    {
+        size_type offset{pos};
+        return locate(offset)->items()[offset];
+    }
+
+    const_reference operator[](const size_type pos) const final
+    {
+        size_type offset{pos};
+        return locate(offset)->items()[offset];
+    }
+
+    reference at(const size_type pos)
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    const_reference at(const size_type pos) const
+    {
+        if (pos >= m_size)
+        {
+            throw std::out_of_range{"Index out of range."};
+        }
+        return (*this)[pos];
+    }
+
+    // Iterator pointing at beginning.
+    iterator begin()
+    {
+        return iterator{m_head};
+    }
+
+    // Iterator pointing one past the end.
+    iterator end()
+    {
+        return iterator{nullptr};
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator{m_head};
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator{nullptr};
+    }
+};
+
+// Print the list.
+template <typename T, std::size_t K>
+std::ostream& operator<<(std::ostream& os, const UnrolledForwardList<T, K>& list)
+{
+    for (const auto& item : list)
+    {
+        os << item << ' ';
+    }
+
+    return os;
+}
+#endif // UNROLLEDFORWARDLIST_HPP
@@ -0,0 +1,101 @@
+// This is an iterator class for convenient use of STL algorithms.
+#ifndef UNROLLEDFORWARDLISTITERATOR_HPP
+#define UNROLLEDFORWARDLISTITERATOR_HPP
+
+#include "UnrolledNode.hpp"
+
+#include <cstddef>     // std::ptrdiff_t, std::size_t
+#include <iterator>    // std::forward_iterator_tag
+#include <type_traits> // std::conditional_t, std::is_const_v, std::remove_const_t
+
+// This class is used in order to be compliant with the STL algorithms.
+// It walks the items of a node before moving on to the next node, so most
+// steps stay within the same cache lines.
+// UnrolledForwardListIterator<const T, K> is the const_iterator.
+template <typename T, std::size_t K>
+class UnrolledForwardListIterator
+{
+public:
+    // std::forward_iterator_tag since we can only move forward in a singly linked list.
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_const_t<T>;
+    using pointer           = T*;
+    using reference         = T&;
+
+private:
+    using node_pointer = std::conditional_t<std::is_const_v<T>,
+                                            const UnrolledNode<value_type, K>*,
+                                            UnrolledNode<value_type, K>*>;
+
+    node_pointer m_node{nullptr}; // Node of the current item.
+    std::size_t  m_index{};       // Position of the item in the node.
+
+public:
+    // Default constructor.
+    UnrolledForwardListIterator() = default;
+
+    // Constructor with a node and a position in it.
+    explicit UnrolledForwardListIterator(node_pointer node, const std::size_t index = 0)
+        : m_node{node}, m_index{index}
+    {
+    }
+
+    // An iterator converts to a const_iterator, but not the other way.
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    UnrolledForwardListIterator(const UnrolledForwardListIterator<U, K>& other)
+        : m_node{other.node()}, m_index{other.index()}
+    {
+    }
+
+    // Access the data directly at the current iterator position.
+    reference operator*() const
+    {
+        return m_node->items()[m_index];
+    }
+
+    // To point at the current iterator position.
+    pointer operator->() const
+    {
+        return m_node->items() + m_index;
+    }
+
+    // To move one position forward. (Pre-increment)
+    UnrolledForwardListIterator& operator++()
+    {
+        // Nodes are never empty, so the next one starts with an item.
+        if (++m_index == m_node->count)
+        {
+            m_node  = m_node->next;
+            m_index = 0;
+        }
+        return *this;
+    }
+
+    // To move one position forward. (Post-increment)
+    UnrolledForwardListIterator operator++(int)
+    {
+        UnrolledForwardListIterator tmp = *this; // Save the current iterator position.
+        ++(*this);
+        return tmp;
+    }
+
+    // To compare iterators for equality.
+    friend bool operator==(const UnrolledForwardListIterator& it1,
+                           const UnrolledForwardListIterator& it2)
+    {
+        return it1.m_node == it2.m_node && it1.m_index == it2.m_index;
+    }
+
+    node_pointer node() const noexcept
+    {
+        return m_node;
+    }
+
+    std::size_t index() const noexcept
+    {
+        return m_index;
+    }
+};
+#endif // UNROLLEDFORWARDLISTITERATOR_HPP
@@ -0,0 +1,27 @@
+#ifndef UNROLLEDNODE_HPP
+#define UNROLLEDNODE_HPP
+
+#include <cstddef> // std::size_t, std::byte
+#include <new>     // std::launder
+
+// Node of an UnrolledForwardList, holding up to K items.
+template <typename T, std::size_t K>
+struct UnrolledNode
+{
+    UnrolledNode* next{nullptr}; // Pointer to the next node.
+    std::size_t   count{};       // Number of items in the node.
+
+    // Raw storage, only the first "count" items are constructed.
+    alignas(T) std::byte storage[K * sizeof(T)];
+
+    T* items() noexcept
+    {
+        return std::launder(reinterpret_cast<T*>(storage));
+    }
+
+    const T* items() const noexcept
+    {
+        return std::launder(reinterpret_cast<const T*>(storage));
+    }
+};
+#endif // UNROLLEDNODE_HPP
@@ -0,0 +1,105 @@
+// Checks that the vector min/max kernels agree with the scalar loops on
+// floating point input with NaNs in it.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -I../include ArrayListSimdTest.cpp && ./a.out
+#include "ArrayListSimd.hpp"
+
+#include <cassert>  // assert
+#include <cmath>    // std::isnan
+#include <cstddef>  // std::size_t
+#include <iostream> // std::cout
+#include <limits>   // std::numeric_limits
+#include <random>   // std::mt19937, std::uniform_real_distribution, std::uniform_int_distribution
+#include <vector>   // std::vector
+
+namespace
+{
+    // Same value, or both NaN.
+    template <typename T>
+    bool same(const T lhs, const T rhs)
+    {
+        return (std::isnan(lhs) && std::isnan(rhs)) || lhs == rhs;
+    }
+
+    // Compare every kernel the machine has with the scalar loop on "data".
+    template <typename T>
+    void check(const std::vector<T>& data)
+    {
+        using arraylist_simd::Scalar;
+
+        const T*          items = data.data();
+        const std::size_t size{data.size()};
+
+        const T min{Scalar<T>::min(items, size)};
+        const T max{Scalar<T>::max(items, size)};
+
+        assert(same(arraylist_simd::min(items, size), min));
+        assert(same(arraylist_simd::max(items, size), max));
+
+#ifdef ARRAYLIST_SIMD_VECTOR
+        assert(same(arraylist_simd::Vector<T, 16>::min(items, size), min));
+        assert(same(arraylist_simd::Vector<T, 16>::max(items, size), max));
+        assert(same(arraylist_simd::Vector<T, 32>::min(items, size), min));
+        assert(same(arraylist_simd::Vector<T, 32>::max(items, size), max));
+#endif
+
+#ifdef ARRAYLIST_SIMD_X86
+        if (arraylist_simd::has_avx2())
+        {
+            assert(same(arraylist_simd::avx2_kernels<T>::min(items, size), min));
+            assert(same(arraylist_simd::avx2_kernels<T>::max(items, size), max));
+        }
+        if (arraylist_simd::has_sse2())
+        {
+            assert(same(arraylist_simd::sse2_kernels<T>::min(items, size), min));
+            assert(same(arraylist_simd::sse2_kernels<T>::max(items, size), max));
+        }
+#endif
+    }
+
+    template <typename T>
+    void run(std::mt19937& gen)
+    {
+        constexpr T NaN{std::numeric_limits<T>::quiet_NaN()};
+
+        // Nonzero values, the sign of a zero result may differ by design.
+        std::uniform_real_distribution<T>  value{T{1}, T{1000}};
+        std::uniform_int_distribution<int> sign{0, 1};
+
+        for (std::size_t size{1}; size <= 70; ++size)
+        {
+            std::vector<T> data(size);
+            for (auto& item : data)
+            {
+                item = sign(gen) != 0 ? value(gen) : -value(gen);
+            }
+
+            check(data);
+
+            // A NaN at every position, alone and with a second one after it.
+            for (std::size_t pos{}; pos < size; ++pos)
+            {
+                std::vector<T> with_nan{data};
+                with_nan[pos] = NaN;
+                check(with_nan);
+
+                with_nan[(pos + 1 + size / 2) % size] = NaN;
+                check(with_nan);
+            }
+
+            check(std::vector<T>(size, NaN));
+        }
+    }
+} // namespace
+
+int main()
+{
+    std::mt19937 gen{2024};
+
+    run<float>(gen);
+    run<double>(gen);
+
+    std::cout << "All ArrayListSimd tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Checks that a moved-from MappedArrayList behaves as an empty list.
+//
+// Build and run from this directory (POSIX only):
+//   g++ -std=c++20 -O2 -I../include MappedArrayListTest.cpp && ./a.out
+#include "MappedArrayList.hpp"
+
+#include <cassert>      // assert
+#include <cstdio>       // std::remove
+#include <iostream>     // std::cout
+#include <stdexcept>    // std::out_of_range
+#include <string>       // std::string
+#include <system_error> // std::system_error
+#include <utility>      // std::move
+
+namespace
+{
+    // Every member a moved-from list may be used with.
+    void check_moved_from(MappedArrayList<int>& list)
+    {
+        assert(list.size() == 0);
+        assert(list.capacity() == 0);
+        assert(list.empty());
+        assert(list.begin() == list.end());
+
+        list.clear();
+        list.sync();
+        assert(list.empty());
+
+        // Changes need a file, which the list no longer has.
+        bool threw{false};
+        try
+        {
+            list.append(1);
+        }
+        catch (const std::system_error&)
+        {
+            threw = true;
+        }
+        assert(threw);
+
+        threw = false;
+        try
+        {
+            list.remove(0);
+        }
+        catch (const std::out_of_range&)
+        {
+            threw = true;
+        }
+        assert(threw);
+    }
+} // namespace
+
+int main()
+{
+    const std::string path{"mapped_array_list_test.bin"};
+    std::remove(path.c_str());
+
+    {
+        MappedArrayList<int> list{path};
+        for (int i{}; i < 100; ++i)
+        {
+            list.append(i);
+        }
+
+        // Move construction.
+        MappedArrayList<int> moved{std::move(list)};
+        assert(moved.size() == 100);
+        check_moved_from(list);
+
+        // Move assignment.
+        MappedArrayList<int> other{path};
+        other = std::move(moved);
+        assert(other.size() == 100 && other[99] == 99);
+        check_moved_from(moved);
+    }
+
+    std::remove(path.c_str());
+
+    std::cout << "All MappedArrayList tests passed.\n";
+    return 0;
+}
@@ -0,0 +1,155 @@
+// LruCache and ShardedLruCache under Zipfian keys: a few keys are hot and
+// most are rare, as in real caches. Every lookup that misses puts the key.
+//
+// Build and run from this directory:
+//   g++ -std=c++20 -O2 -pthread -I../include LruCacheBenchmark.cpp && ./a.out
+#include "LruCache.hpp"
+
+#include <algorithm> // std::min, std::upper_bound
+#include <chrono>    // std::chrono::steady_clock
+#include <cmath>     // std::pow
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <cstdio>    // std::printf
+#include <limits>    // std::numeric_limits
+#include <random>    // std::mt19937_64, std::uniform_real_distribution
+#include <thread>    // std::thread
+#include <vector>    // std::vector
+
+namespace
+{
+    constexpr std::size_t KEYS{1'000'000};  // Distinct keys.
+    constexpr std::size_t LOOKUPS{4'000'000}; // Lookups per run.
+    constexpr double      SKEW{0.99};       // Zipf exponent.
+    constexpr int         REPEATS{3};
+
+    // "count" keys in [0, KEYS), key k drawn with weight 1 / (k + 1)^SKEW.
+    std::vector<std::uint64_t> zipf_keys(const std::size_t count, const std::uint64_t seed)
+    {
+        std::vector<double> cdf(KEYS);
+        double              total{};
+        for (std::size_t k{}; k < KEYS; ++k)
+        {
+            total += 1.0 / std::pow(static_cast<double>(k + 1), SKEW);
+            cdf[k] = total;
+        }
+
+        std::mt19937_64                        gen{seed};
+        std::uniform_real_distribution<double> uniform{0.0, total};
+
+        // Spread the hot keys over the table instead of keeping them adjacent.
+        std::vector<std::uint64_t> keys(count);
+        for (auto& key : keys)
+        {
+            const auto rank = static_cast<std::uint64_t>(
+                std::upper_bound(cdf.begin(), cdf.end(), uniform(gen)) - cdf.begin());
+            key = std::min<std::uint64_t>(rank, KEYS - 1) * 0x9E3779B97F4A7C15;
+        }
+        return keys;
+    }
+
+    // Run "body" "repeats" times and return the fastest run in nanoseconds.
+    template <typename Body>
+    double best_ns(Body&& body)
+    {
+        double best{std::numeric_limits<double>::max()};
+
+        for (int run{}; run < REPEATS; ++run)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            body();
+            const auto stop = std::chrono::steady_clock::now();
+
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        return best;
+    }
+
+    void single_thread(const std::vector<std::uint64_t>& keys)
+    {
+        std::printf("LruCache, one thread\n");
+
+        for (const std::size_t capacity : {KEYS / 100, KEYS / 10})
+        {
+            LruStats stats{};
+
+            const double ns = best_ns([&keys, &stats, capacity] {
+                LruCache<std::uint64_t, std::uint64_t> cache{capacity};
+                for (const std::uint64_t key : keys)
+                {
+                    if (cache.get(key) == nullptr)
+                    {
+                        cache.put(key, key);
+                    }
+                }
+                stats = cache.stats();
+            });
+
+            std::printf("  capacity %8zu: %7.1f ns/lookup, hit rate %5.1f%%\n",
+                        capacity,
+                        ns / static_cast<double>(keys.size()),
+                        100.0 * static_cast<double>(stats.hits) /
+                            static_cast<double>(stats.hits + stats.misses));
+        }
+    }
+
+    // Every thread runs its own slice of "keys" against one shared cache.
+    void sharded(const std::vector<std::uint64_t>& keys)
+    {
+        constexpr std::size_t CAPACITY{KEYS / 10};
+
+        std::printf("ShardedLruCache, capacity %zu, lookups/s over all threads\n", CAPACITY);
+
+        for (const std::size_t threads : {1, 2, 4, 8, 16})
+        {
+            std::printf("  %2zu threads:", threads);
+
+            for (const std::size_t shards : {1, 16, 64})
+            {
+                const std::size_t per_thread{keys.size() / threads};
+
+                const double ns = best_ns([&keys, threads, shards, per_thread] {
+                    ShardedLruCache<std::uint64_t, std::uint64_t> cache{CAPACITY, shards};
+
+                    std::vector<std::thread> workers;
+                    for (std::size_t t{}; t < threads; ++t)
+                    {
+                        workers.emplace_back([&cache, &keys, t, per_thread] {
+                            for (std::size_t i{t * per_thread}; i < (t + 1) * per_thread; ++i)
+                            {
+                                if (!cache.get(keys[i]))
+                                {
+                                    cache.put(keys[i], keys[i]);
+                                }
+                            }
+                        });
+                    }
+                    for (auto& worker : workers)
+                    {
+                        worker.join();
+                    }
+                });
+
+                const double lookups = static_cast<double>(per_thread * threads);
+                std::printf("  %2zu shards %6.2f M/s", shards, lookups / ns * 1e3);
+            }
+            std::printf("\n");
+        }
+    }
+} // namespace
+
+int main()
+{
+    std::printf("%zu keys, Zipf exponent %.2f, %zu lookups, best of %d runs\n",
+                KEYS,
+                SKEW,
+                LOOKUPS,
+                REPEATS);
+
+    const std::vector<std::uint64_t> keys{zipf_keys(LOOKUPS, 2024)};
+
+    single_thread(keys);
+    sharded(keys);
+
+    return 0;
+}
@@ -7,8 +7,9 @@
 
 #include <cstddef> // std::size_t
 #include <initializer_list>
-#include <iostream> // operator<<
-#include <utility>  // std::exchange
+#include <iostream>  // operator<<
+#include <stdexcept> // std::out_of_range
+#include <utility>   // std::exchange, std::forward, std::swap, std::in_place
 
 template <typename T>
 class DList
@@ -30,6 +31,51 @@ private:
 
     size_type m_size{};
 
+    // Return the node at "pos", which must be less than m_size. Walks from
+    // whichever end is closer.
+    Node<value_type>* node_at(const size_type pos) const
+    {
+        Node<value_type>* temp{nullptr};
+
+        if (pos < m_size / 2)
+        {
+            temp = m_head;
+            for (size_type i{}; i != pos; ++i)
+            {
+                temp = temp->next;
+            }
+        }
+        else
+        {
+            temp = m_tail;
+            for (size_type i{m_size - 1}; i != pos; --i)
+            {
+                temp = temp->prev;
+            }
+        }
+        return temp;
+    }
+
+    // Link "node" in front of "next", at the back if "next" is nullptr.
+    // Doesn't touch m_size.
+    void link_before(Node<value_type>* next, Node<value_type>* node) noexcept
+    {
+        Node<value_type>* prev = next == nullptr ? m_tail : next->prev;
+
+        node->prev = prev;
+        node->next = next;
+
+        (prev == nullptr ? m_head : prev->next) = node;
+        (next == nullptr ? m_tail : next->prev) = node;
+    }
+
+    // Take "node" out of the list without deleting it. Doesn't touch m_size.
+    void unlink(Node<value_type>* node) noexcept
+    {
+        (node->prev == nullptr ? m_head : node->prev->next) = node->next;
+        (node->next == nullptr ? m_tail : node->next->prev) = node->prev;
+    }
+
 public:
     // Default ctor.
     DList() = default;
@@ -268,38 +314,29 @@ public:
         {
             push_back(item);
         }
-        // If the position is the beginning of the list, prepend the new node.
-        else if (pos == 0ULL)
-        {
-            push_front(item);
-        }
         else
         {
-            // Create a new node.
-            auto new_item = new Node<value_type>{item};
+            insert(iterator{node_at(pos)}, item);
+        }
+    }
 
-            // Starting from the head, go to the position.
-            auto temp = m_head;
-            for (size_type i{}; i < pos; ++i)
-            {
-                temp = temp->next;
-            }
+    // Insert "item" in front of "pos". Return iterator at the new item. O(1).
+    iterator insert(iterator pos, const_reference item)
+    {
+        return emplace(pos, item);
+    }
 
-            // Update pointers, connect new_item to the previous element two
-            // ways. Update the previous element's next pointer.
-            temp->prev->next = new_item;
-            // Update the new item's previous pointer pointing to the previous
-            // element.
-            new_item->prev = temp->prev;
-            // Connect new_item to the next element two ways.
-            // Update the new item's next pointer pointing to the next element.
-            new_item->next = temp;
-            // Update the next element's previous pointer pointing to the new
-            // item.
-            temp->prev = new_item;
+    // Construct an item from "args" in front of "pos". Return iterator at
+    // it. O(1).
+    template <typename... Args>
+    iterator emplace(iterator pos, Args&&... args)
+    {
+        auto new_item = new Node<value_type>(std::in_place, std::forward<Args>(args)...);
 
-            m_size++;
-        }
+        link_before(pos.operator->(), new_item);
+        ++m_size;
+
+        return iterator{new_item};
     }
 
     void pop_front()
@@ -367,40 +404,100 @@ public:
         }
         else
         {
-            Node<value_type>* marked = m_head;
-            // Go to the pos.
-            for (size_type i{}; i < pos; ++i)
-            {
-                marked = marked->next;
-            }
+            erase(iterator{node_at(pos)});
+        }
+    }
 
-            // If the marked is the head.
-            if (marked == m_head)
-            {
-                pop_front();
-                return;
-            }
-            else
+    // Remove the item at "pos". Return iterator at the one after it. O(1).
+    iterator erase(iterator pos)
+    {
+        Node<value_type>* marked = pos.operator->();
+        Node<value_type>* next   = marked->next;
+
+        unlink(marked);
+        delete marked;
+        --m_size;
+
+        return iterator{next};
+    }
+
+    // Remove the items in [first, last). Return "last".
+    iterator erase(iterator first, const iterator last)
+    {
+        while (first != last)
+        {
+            first = erase(first);
+        }
+        return last;
+    }
+
+    /**
+     * @brief Move the items in [first, last) of "other" in front of "pos".
+     *
+     * @details The nodes are relinked, not copied, so iterators to them stay
+     * valid and now point into this list. O(1) within the same list, where
+     * "pos" must not be in [first, last). From another list, the moved items
+     * are counted to keep both sizes right, which is linear in their number.
+     */
+    void splice(iterator pos, DList& other, iterator first, iterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        Node<value_type>* first_node = first.operator->();
+        Node<value_type>* end_node   = last.operator->();
+        Node<value_type>* last_node  = end_node == nullptr ? other.m_tail : end_node->prev;
+
+        if (&other != this)
+        {
+            size_type count{1};
+            for (auto temp = first_node; temp != last_node; temp = temp->next)
             {
-                // Update pointers.
-                // Connect the previous element's next pointer to the next
-                // element.
-                marked->prev->next = marked->next;
-                // Connect the next element's previous pointer to the previous
-                // element.
-                marked->next->prev = marked->prev;
-
-                delete marked;
-                --m_size;
-
-                // If the list is empty, reset m_head and m_tail.
-                if (m_size == 0)
-                {
-                    m_head = nullptr;
-                    m_tail = nullptr;
-                }
+                ++count;
             }
+
+            other.m_size -= count;
+            m_size += count;
         }
+
+        // Close the gap in "other".
+        (first_node->prev == nullptr ? other.m_head : first_node->prev->next) = end_node;
+        (end_node == nullptr ? other.m_tail : end_node->prev) = first_node->prev;
+
+        // Link the range in front of "pos".
+        Node<value_type>* next = pos.operator->();
+        Node<value_type>* prev = next == nullptr ? m_tail : next->prev;
+
+        first_node->prev = prev;
+        last_node->next  = next;
+
+        (prev == nullptr ? m_head : prev->next) = first_node;
+        (next == nullptr ? m_tail : next->prev) = last_node;
+    }
+
+    // Move every item of "other" in front of "pos". O(1).
+    void splice(iterator pos, DList& other)
+    {
+        if (&other == this || other.empty())
+        {
+            return;
+        }
+
+        // Link the whole chain in front of "pos".
+        Node<value_type>* next = pos.operator->();
+        Node<value_type>* prev = next == nullptr ? m_tail : next->prev;
+
+        other.m_head->prev = prev;
+        other.m_tail->next = next;
+
+        (prev == nullptr ? m_head : prev->next) = other.m_head;
+        (next == nullptr ? m_tail : next->prev) = other.m_tail;
+
+        m_size += std::exchange(other.m_size, 0ULL);
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
     }
 
     reference operator[](const size_type pos)
@@ -410,12 +507,7 @@ public:
             throw std::out_of_range("Index out of bounds");
         }
 
-        Node<value_type>* temp = m_head;
-        for (size_type i{}; i != pos; ++i)
-        {
-            temp = temp->next;
-        }
-        return temp->data;
+        return node_at(pos)->data;
     }
 
     const_reference operator[](const size_type pos) const
@@ -425,12 +517,22 @@ public:
             throw std::out_of_range("Index out of bounds");
         }
 
-        Node<value_type>* temp = m_head;
-        for (size_type i{}; i != pos; ++i)
+        return node_at(pos)->data;
+    }
+
+    // Move the item at "pos" to the front by relinking its node. O(1).
+    void move_to_front(iterator pos)
+    {
+        Node<value_type>* node = pos.operator->();
+
+        // Already there.
+        if (node == m_head)
         {
-            temp = temp->next;
+            return;
         }
-        return temp->data;
+
+        unlink(node);
+        link_before(m_head, node);
     }
 
     // Reverse the pointers.
@@ -481,65 +583,18 @@ public:
         std::swap(m_size, other.m_size);
     }
 
-    // Check if a value exists in the list
-    [[nodiscard]]
-    bool contains(const_reference value) const
-    {
-        for (const auto& item : *this)
-        {
-            if (item == value)
-            {
-                return true;
-            }
-        }
-        return false;
-    }
-
     // Construct element directly in the new node at the front
     template <typename... Args>
     void emplace_front(Args&&... args)
     {
-        // Create a new node and construct the element in-place using perfect
-        // forwarding
-        auto new_item =
-            new Node<value_type>{value_type(std::forward<Args>(args)...),
-                                 nullptr,
-                                 m_head};
-
-        if (m_head == nullptr)
-        {
-            m_head = new_item;
-            m_tail = new_item;
-        }
-        else
-        {
-            m_head->prev = new_item;
-            m_head       = new_item;
-        }
-        m_size++;
+        emplace(begin(), std::forward<Args>(args)...);
     }
 
     // Construct element directly in the new node at the back
     template <typename... Args>
     void emplace_back(Args&&... args)
     {
-        // Create a new node and construct the element in-place using perfect
-        // forwarding
-        auto new_item =
-            new Node<value_type>{value_type(std::forward<Args>(args)...),
-                                 m_tail};
-
-        if (m_tail == nullptr)
-        {
-            m_head = new_item;
-            m_tail = new_item;
-        }
-        else
-        {
-            m_tail->next = new_item;
-            m_tail       = new_item;
-        }
-        m_size++;
+        emplace(end(), std::forward<Args>(args)...);
     }
 };
 
@@ -0,0 +1,65 @@
+// The links an item of an IntrusiveDList carries inside itself.
+#ifndef DLISTHOOK_HPP
+#define DLISTHOOK_HPP
+
+template <typename T, typename Tag>
+class IntrusiveDList;
+
+template <typename T, typename Tag>
+class IntrusiveDListIterator;
+
+/**
+ * @brief Base class for items that are threaded onto an IntrusiveDList.
+ *
+ * @details An item derives from one hook per list it can be in at the same
+ * time, told apart by "Tag":
+ *
+ *     struct LruTag;
+ *     struct TimerTag;
+ *
+ *     struct Entry : DListHook<LruTag>, DListHook<TimerTag>
+ *     {
+ *         int key;
+ *     };
+ *
+ * Copying an item doesn't copy its links, the copy starts out unlinked.
+ *
+ * @tparam Tag Names the list the hook is for.
+ */
+template <typename Tag = void>
+class DListHook
+{
+public:
+    DListHook() noexcept = default;
+
+    // The links belong to the object, not to its value.
+    DListHook(const DListHook&) noexcept
+    {
+    }
+
+    DListHook& operator=(const DListHook&) noexcept
+    {
+        return *this;
+    }
+
+    // Whether the item is in a list.
+    [[nodiscard]]
+    bool is_linked() const noexcept
+    {
+        return m_prev != this;
+    }
+
+private:
+    template <typename, typename>
+    friend class IntrusiveDList;
+
+    template <typename, typename>
+    friend class IntrusiveDListIterator;
+
+    // An unlinked hook points back to itself, a linked one at its neighbours,
+    // or nullptr at either end of the list.
+    DListHook* m_prev{this};
+    DListHook* m_next{nullptr};
+};
+
+#endif // DLISTHOOK_HPP
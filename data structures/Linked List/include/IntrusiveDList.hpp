@@ -0,0 +1,302 @@
+// A doubly linked list threaded through the items themselves.
+#ifndef INTRUSIVEDLIST_HPP
+#define INTRUSIVEDLIST_HPP
+
+#include "DListHook.hpp"
+#include "IntrusiveDListIterator.hpp"
+
+#include <concepts>  // std::derived_from
+#include <cstddef>   // std::size_t
+#include <iostream>  // operator<<
+#include <stdexcept> // std::logic_error
+#include <utility>   // std::exchange, std::swap
+
+/**
+ * @brief A doubly linked list of items that carry their own links.
+ *
+ * @details Where DList allocates a node and copies the item into it, this
+ * list links the items where they are, through the DListHook<Tag> they
+ * derive from. Nothing is allocated or copied. Linking and unlinking an
+ * item, including erasing it by reference, are O(1).
+ *
+ * The list doesn't own the items. An item must outlive its time in the
+ * list, and can be in one list per hook at a time.
+ *
+ * @tparam T The type of the items, derived from DListHook<Tag>.
+ * @tparam Tag Names the hook to use.
+ */
+template <typename T, typename Tag = void>
+class IntrusiveDList
+{
+    static_assert(std::derived_from<T, DListHook<Tag>>,
+                  "Items must derive from DListHook<Tag>.");
+
+public:
+    // Type aliases for STL compatibility.
+    using value_type      = T;
+    using size_type       = std::size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = IntrusiveDListIterator<value_type, Tag>;
+    using const_iterator  = IntrusiveDListIterator<const value_type, Tag>;
+
+private:
+    using hook_type = DListHook<Tag>;
+
+    hook_type* m_head{nullptr};
+    hook_type* m_tail{nullptr};
+
+    size_type m_size{};
+
+    static hook_type* hook_of(reference item) noexcept
+    {
+        return static_cast<hook_type*>(&item);
+    }
+
+    static void check_unlinked(const hook_type* hook)
+    {
+        if (hook->is_linked())
+        {
+            throw std::logic_error{"Item is already in a list."};
+        }
+    }
+
+    // Link "hook" in front of "next", at the back if "next" is nullptr.
+    void link_before(hook_type* next, hook_type* hook) noexcept
+    {
+        hook_type* prev = next == nullptr ? m_tail : next->m_prev;
+
+        hook->m_prev = prev;
+        hook->m_next = next;
+
+        (prev == nullptr ? m_head : prev->m_next) = hook;
+        (next == nullptr ? m_tail : next->m_prev) = hook;
+
+        ++m_size;
+    }
+
+    // Take "hook" out of the list and mark it unlinked.
+    void unlink(hook_type* hook) noexcept
+    {
+        (hook->m_prev == nullptr ? m_head : hook->m_prev->m_next) = hook->m_next;
+        (hook->m_next == nullptr ? m_tail : hook->m_next->m_prev) = hook->m_prev;
+
+        hook->m_prev = hook;
+        hook->m_next = nullptr;
+
+        --m_size;
+    }
+
+public:
+    // Default ctor.
+    IntrusiveDList() = default;
+
+    // An item has room for a single list per hook.
+    IntrusiveDList(const IntrusiveDList&)            = delete;
+    IntrusiveDList& operator=(const IntrusiveDList&) = delete;
+
+    // Move ctor. The items stay linked to each other, only the ends move.
+    IntrusiveDList(IntrusiveDList&& other) noexcept
+        : m_head{std::exchange(other.m_head, nullptr)},
+          m_tail{std::exchange(other.m_tail, nullptr)},
+          m_size{std::exchange(other.m_size, 0ULL)}
+    {
+    }
+
+    // Move assignment operator.
+    IntrusiveDList& operator=(IntrusiveDList&& other) noexcept
+    {
+        if (&other != this)
+        {
+            clear();
+
+            m_head = std::exchange(other.m_head, nullptr);
+            m_tail = std::exchange(other.m_tail, nullptr);
+            m_size = std::exchange(other.m_size, 0ULL);
+        }
+
+        return *this;
+    }
+
+    // Dtor. Unlinks the items, they can join other lists afterwards.
+    ~IntrusiveDList()
+    {
+        clear();
+    }
+
+    // Unlink every item. O(n), since each one is marked unlinked.
+    void clear() noexcept
+    {
+        while (m_head != nullptr)
+        {
+            hook_type* hook = std::exchange(m_head, m_head->m_next);
+
+            hook->m_prev = hook;
+            hook->m_next = nullptr;
+        }
+
+        m_tail = nullptr;
+        m_size = 0ULL;
+    }
+
+    void swap(IntrusiveDList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_size, other.m_size);
+    }
+
+    [[nodiscard]]
+    iterator begin() noexcept
+    {
+        return iterator{m_head};
+    }
+
+    [[nodiscard]]
+    iterator end() noexcept
+    {
+        // The end is nullptr.
+        return iterator{nullptr};
+    }
+
+    [[nodiscard]]
+    const_iterator begin() const noexcept
+    {
+        return const_iterator{m_head};
+    }
+
+    [[nodiscard]]
+    const_iterator end() const noexcept
+    {
+        return const_iterator{nullptr};
+    }
+
+    [[nodiscard]]
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    [[nodiscard]]
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    // Iterator at "item", which must be in this list.
+    [[nodiscard]]
+    iterator iterator_to(reference item) noexcept
+    {
+        return iterator{hook_of(item)};
+    }
+
+    [[nodiscard]]
+    reference front()
+    {
+        return static_cast<reference>(*m_head);
+    }
+
+    [[nodiscard]]
+    reference back()
+    {
+        return static_cast<reference>(*m_tail);
+    }
+
+    [[nodiscard]]
+    const_reference front() const
+    {
+        return static_cast<const_reference>(*m_head);
+    }
+
+    [[nodiscard]]
+    const_reference back() const
+    {
+        return static_cast<const_reference>(*m_tail);
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return m_size == 0ULL;
+    }
+
+    // Throws std::logic_error if "item" is already in a list.
+    void push_front(reference item)
+    {
+        check_unlinked(hook_of(item));
+        link_before(m_head, hook_of(item));
+    }
+
+    // Throws std::logic_error if "item" is already in a list.
+    void push_back(reference item)
+    {
+        check_unlinked(hook_of(item));
+        link_before(nullptr, hook_of(item));
+    }
+
+    // Link "item" in front of "pos". Return iterator at "item".
+    iterator insert(iterator pos, reference item)
+    {
+        check_unlinked(hook_of(item));
+        link_before(pos.hook(), hook_of(item));
+        return iterator{hook_of(item)};
+    }
+
+    void pop_front() noexcept
+    {
+        // If there's no element, exit.
+        if (m_head != nullptr)
+        {
+            unlink(m_head);
+        }
+    }
+
+    void pop_back() noexcept
+    {
+        // If the list is empty, exit.
+        if (m_tail != nullptr)
+        {
+            unlink(m_tail);
+        }
+    }
+
+    // Unlink "item", which must be in this list.
+    void erase(reference item) noexcept
+    {
+        unlink(hook_of(item));
+    }
+
+    // Unlink the item at "pos". Return iterator at the one after it.
+    iterator erase(iterator pos) noexcept
+    {
+        hook_type* next = pos.hook()->m_next;
+        unlink(pos.hook());
+        return iterator{next};
+    }
+};
+
+template <typename T, typename Tag>
+std::ostream& operator<<(std::ostream& out, const IntrusiveDList<T, Tag>& dlist)
+{
+    // Format: [item1, item2, item3, ...]
+    out << '[';
+    for (auto it = dlist.begin(); it != dlist.end(); ++it)
+    {
+        if (it != dlist.begin())
+        {
+            out << ", ";
+        }
+        out << *it;
+    }
+    out << ']';
+    return out;
+}
+#endif // INTRUSIVEDLIST_HPP
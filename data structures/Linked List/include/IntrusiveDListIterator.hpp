@@ -0,0 +1,106 @@
+// An iterator class for taking advantage of the Modern C++ STL algorithms.
+#ifndef INTRUSIVEDLISTITERATOR_HPP
+#define INTRUSIVEDLISTITERATOR_HPP
+
+#include "DListHook.hpp"
+
+#include <cstddef>     // std::ptrdiff_t
+#include <iterator>    // std::bidirectional_iterator_tag
+#include <type_traits> // std::conditional_t, std::is_const_v, std::remove_const_t
+
+// Same as DListIterator, but walks the hooks embedded in the items.
+// IntrusiveDListIterator<const T, Tag> is the const_iterator.
+template <typename T, typename Tag = void>
+class IntrusiveDListIterator
+{
+public:
+    // Bidirectional iterator because its a doubly linked list.
+    // It can move forward and backward.
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::remove_const_t<T>;
+    using pointer           = T*;
+    using reference         = T&;
+
+private:
+    using hook_pointer = std::conditional_t<std::is_const_v<T>,
+                                            const DListHook<Tag>*,
+                                            DListHook<Tag>*>;
+
+    hook_pointer m_ptr{nullptr};
+
+public:
+    IntrusiveDListIterator() = default;
+
+    // Explicit because we don't want the compiler to do any implicit
+    // conversions.
+    explicit IntrusiveDListIterator(hook_pointer ptr)
+        : m_ptr{ptr}
+    {
+    }
+
+    // Allow conversion from regular iterator to const_iterator.
+    template <typename U>
+        requires(std::is_const_v<T> && std::is_same_v<const U, T>)
+    IntrusiveDListIterator(const IntrusiveDListIterator<U, Tag>& other)
+        : m_ptr{other.hook()}
+    {
+    }
+
+    // Dereference operator.
+    reference operator*() const
+    {
+        return static_cast<reference>(*m_ptr); // The hook is a base of T.
+    }
+
+    // Pointing at the current iterator position.
+    pointer operator->() const
+    {
+        return &**this;
+    }
+
+    // Prefix increment operator.
+    IntrusiveDListIterator& operator++()
+    {
+        m_ptr = m_ptr->m_next; // Move to the next item.
+        return *this;
+    }
+
+    // Postfix increment operator.
+    IntrusiveDListIterator operator++(int)
+    {
+        IntrusiveDListIterator tmp{*this}; // Create a copy of the current iterator.
+        ++(*this);                         // Move to the next item.
+        return tmp;                        // Return the copy of the original iterator.
+    }
+
+    // Prefix decrement operator.
+    IntrusiveDListIterator& operator--()
+    {
+        m_ptr = m_ptr->m_prev; // Move to the previous item.
+        return *this;
+    }
+
+    // Postfix decrement operator.
+    IntrusiveDListIterator operator--(int)
+    {
+        IntrusiveDListIterator tmp{*this}; // Create a copy of the current iterator.
+        --(*this);                         // Move to the previous item.
+        return tmp;                        // Return the copy of the original iterator.
+    }
+
+    // Equality operator.
+    friend bool operator==(const IntrusiveDListIterator& it1,
+                           const IntrusiveDListIterator& it2)
+    {
+        return it1.m_ptr == it2.m_ptr; // Compare the pointers.
+    }
+
+    // The hook of the current item.
+    hook_pointer hook() const noexcept
+    {
+        return m_ptr;
+    }
+};
+
+#endif // INTRUSIVEDLISTITERATOR_HPP
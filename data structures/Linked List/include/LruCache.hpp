@@ -0,0 +1,408 @@
+// A bounded cache that evicts the least recently used entry.
+#ifndef LRUCACHE_HPP
+#define LRUCACHE_HPP
+
+#include "DList.hpp"
+#include "Node.hpp"
+
+#include <bit>        // std::bit_ceil, std::countr_zero
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <deque>      // std::deque
+#include <functional> // std::function, std::hash, std::equal_to
+#include <memory>     // std::unique_ptr, std::make_unique
+#include <mutex>      // std::mutex, std::lock_guard
+#include <optional>   // std::optional
+#include <stdexcept>  // std::invalid_argument
+#include <utility>    // std::move
+
+// What an LruCache has done so far.
+struct LruStats
+{
+    std::size_t hits{};      // Lookups that found their key.
+    std::size_t misses{};    // Lookups that didn't.
+    std::size_t evictions{}; // Entries dropped to make room.
+};
+
+/**
+ * @brief A cache of at most "capacity" entries, dropping the least recently
+ * used one when full.
+ *
+ * @details The entries are kept in a DList from the most to the least
+ * recently used. An open-addressing hash table with linear probing maps the
+ * keys to their nodes, so a hit finds its node and moves it to the front in
+ * O(1), and eviction pops the back. The table has at least twice as many
+ * slots as the cache has entries, so probes stay short, and erasing shifts
+ * the following entries back instead of leaving tombstones.
+ *
+ * get, put and erase are O(1) on average.
+ *
+ * @tparam Key The type of the keys.
+ * @tparam Value The type of the cached values.
+ * @tparam Hash Hash function for the keys.
+ * @tparam KeyEqual Equality of the keys.
+ */
+template <typename Key,
+          typename Value,
+          typename Hash     = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class LruCache
+{
+public:
+    using key_type    = Key;
+    using mapped_type = Value;
+    using size_type   = std::size_t;
+
+    // Called with every evicted entry, just before it is dropped.
+    using evict_callback = std::function<void(const key_type&, mapped_type&)>;
+
+private:
+    struct Entry
+    {
+        key_type    key;
+        mapped_type value;
+    };
+
+    using node_type = Node<Entry>;
+
+    DList<Entry> m_entries; // Most recently used first.
+
+    // Slots of the hash table, nullptr if empty. A power of two of them.
+    std::unique_ptr<node_type*[]> m_slots;
+    size_type                     m_mask{}; // Number of slots minus one.
+
+    size_type      m_capacity{};
+    evict_callback m_on_evict;
+    LruStats       m_stats{};
+
+    [[no_unique_address]] Hash     m_hash{};
+    [[no_unique_address]] KeyEqual m_equal{};
+
+    size_type home_of(const key_type& key) const
+    {
+        return m_hash(key) & m_mask;
+    }
+
+    // Slot holding "key", or the empty slot where it would go.
+    size_type find_slot(const key_type& key) const
+    {
+        size_type slot = home_of(key);
+
+        while (m_slots[slot] != nullptr && !m_equal(m_slots[slot]->data.key, key))
+        {
+            slot = (slot + 1) & m_mask;
+        }
+        return slot;
+    }
+
+    // Empty "slot" and move later entries of the probe run back into the
+    // gap, so every entry stays reachable from its home slot.
+    void erase_slot(size_type slot)
+    {
+        m_slots[slot] = nullptr;
+
+        for (size_type next = (slot + 1) & m_mask; m_slots[next] != nullptr;
+             next           = (next + 1) & m_mask)
+        {
+            const size_type home = home_of(m_slots[next]->data.key);
+
+            // The entry may fill the gap unless its home lies cyclically
+            // in (slot, next], i.e. after the gap.
+            const bool after_gap = slot <= next ? slot < home && home <= next
+                                                : slot < home || home <= next;
+            if (!after_gap)
+            {
+                m_slots[slot] = m_slots[next];
+                m_slots[next] = nullptr;
+                slot          = next;
+            }
+        }
+    }
+
+    // Drop the least recently used entry.
+    void evict()
+    {
+        Entry& victim = m_entries.back();
+
+        if (m_on_evict)
+        {
+            m_on_evict(victim.key, victim.value);
+        }
+
+        erase_slot(find_slot(victim.key));
+        m_entries.pop_back();
+        ++m_stats.evictions;
+    }
+
+public:
+    /**
+     * @brief An empty cache for up to "capacity" entries.
+     *
+     * @details Throws std::invalid_argument if "capacity" is 0.
+     */
+    explicit LruCache(const size_type capacity, evict_callback on_evict = {})
+        : m_capacity{capacity}, m_on_evict{std::move(on_evict)}
+    {
+        if (capacity == 0)
+        {
+            throw std::invalid_argument{"Capacity must be positive."};
+        }
+
+        const size_type slots = std::bit_ceil(capacity * 2);
+
+        m_slots = std::make_unique<node_type*[]>(slots); // All nullptr.
+        m_mask  = slots - 1;
+    }
+
+    // The table points into m_entries, a copy would point into the original.
+    LruCache(const LruCache&)            = delete;
+    LruCache& operator=(const LruCache&) = delete;
+
+    /**
+     * @brief Return pointer to the value of "key", or nullptr if it isn't
+     * cached.
+     *
+     * @details A hit makes the entry the most recently used. The pointer is
+     * valid until the entry is evicted or erased.
+     */
+    mapped_type* get(const key_type& key)
+    {
+        node_type* node = m_slots[find_slot(key)];
+
+        if (node == nullptr)
+        {
+            ++m_stats.misses;
+            return nullptr;
+        }
+
+        ++m_stats.hits;
+        m_entries.move_to_front(typename DList<Entry>::iterator{node});
+        return &node->data.value;
+    }
+
+    // Cache "value" under "key" as the most recently used entry, replacing
+    // an old value. Evicts the least recently used entry if full.
+    void put(const key_type& key, mapped_type value)
+    {
+        size_type  slot = find_slot(key);
+        node_type* node = m_slots[slot];
+
+        if (node != nullptr)
+        {
+            node->data.value = std::move(value);
+            m_entries.move_to_front(typename DList<Entry>::iterator{node});
+            return;
+        }
+
+        if (m_entries.size() == m_capacity)
+        {
+            evict();
+            slot = find_slot(key); // The table may have shifted.
+        }
+
+        m_entries.push_front(Entry{key, std::move(value)});
+        m_slots[slot] = m_entries.begin().operator->();
+    }
+
+    // Drop the entry of "key". Return false if there was none.
+    bool erase(const key_type& key)
+    {
+        const size_type slot = find_slot(key);
+        node_type*      node = m_slots[slot];
+
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        erase_slot(slot);
+
+        // Bring it to the front, where the list can drop it in O(1).
+        m_entries.move_to_front(typename DList<Entry>::iterator{node});
+        m_entries.pop_front();
+
+        return true;
+    }
+
+    // Whether "key" is cached. Doesn't count as a use.
+    [[nodiscard]]
+    bool contains(const key_type& key) const
+    {
+        return m_slots[find_slot(key)] != nullptr;
+    }
+
+    // Drop every entry without calling the eviction callback.
+    void clear()
+    {
+        for (size_type slot{}; slot <= m_mask; ++slot)
+        {
+            m_slots[slot] = nullptr;
+        }
+        m_entries.clear();
+    }
+
+    [[nodiscard]]
+    size_type size() const noexcept
+    {
+        return m_entries.size();
+    }
+
+    [[nodiscard]]
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    [[nodiscard]]
+    LruStats stats() const noexcept
+    {
+        return m_stats;
+    }
+};
+
+/**
+ * @brief An LruCache split into independently locked shards.
+ *
+ * @details Every key belongs to one shard, picked by its hash, and each
+ * shard is an LruCache of its own behind its own mutex. Threads working on
+ * different shards don't wait for each other. Recency is tracked per shard,
+ * so the entry evicted is the least recently used one of its shard.
+ *
+ * get() returns a copy, a pointer into a shard would outlive its lock.
+ * The eviction callback runs with the shard locked.
+ */
+template <typename Key,
+          typename Value,
+          typename Hash     = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class ShardedLruCache
+{
+public:
+    using cache_type     = LruCache<Key, Value, Hash, KeyEqual>;
+    using key_type       = Key;
+    using mapped_type    = Value;
+    using size_type      = std::size_t;
+    using evict_callback = typename cache_type::evict_callback;
+
+private:
+    // Own cache line each, so the shards' locks don't share one.
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        cache_type         cache;
+
+        Shard(const size_type capacity, const evict_callback& on_evict)
+            : cache{capacity, on_evict}
+        {
+        }
+    };
+
+    std::deque<Shard> m_shards;  // A deque never moves its elements.
+    size_type         m_shift{}; // Turns a mixed hash into a shard index.
+
+    [[no_unique_address]] Hash m_hash{};
+
+    Shard& shard_of(const key_type& key)
+    {
+        // Mix the hash, the shards then use its top bits while the tables
+        // inside use its bottom bits.
+        const std::uint64_t mixed = static_cast<std::uint64_t>(m_hash(key)) *
+                                    0x9E3779B97F4A7C15;
+        return m_shards[m_shift == 64 ? 0 : static_cast<size_type>(mixed >> m_shift)];
+    }
+
+public:
+    /**
+     * @brief A cache for about "capacity" entries split into "shards"
+     * shards, rounded up to a power of two.
+     *
+     * @details Each shard holds capacity / shards entries, rounded up.
+     */
+    ShardedLruCache(const size_type capacity,
+                    const size_type shards,
+                    evict_callback  on_evict = {})
+    {
+        if (shards == 0)
+        {
+            throw std::invalid_argument{"Need at least one shard."};
+        }
+
+        const size_type count = std::bit_ceil(shards);
+        const size_type per_shard{(capacity + count - 1) / count};
+
+        m_shift = 64 - static_cast<size_type>(std::countr_zero(count));
+
+        for (size_type i{}; i < count; ++i)
+        {
+            m_shards.emplace_back(per_shard, on_evict);
+        }
+    }
+
+    // Return a copy of the value of "key", or nothing if it isn't cached.
+    std::optional<mapped_type> get(const key_type& key)
+    {
+        Shard&                            shard = shard_of(key);
+        const std::lock_guard<std::mutex> lock{shard.mutex};
+
+        if (const mapped_type* value = shard.cache.get(key))
+        {
+            return *value;
+        }
+        return std::nullopt;
+    }
+
+    void put(const key_type& key, mapped_type value)
+    {
+        Shard&                            shard = shard_of(key);
+        const std::lock_guard<std::mutex> lock{shard.mutex};
+
+        shard.cache.put(key, std::move(value));
+    }
+
+    bool erase(const key_type& key)
+    {
+        Shard&                            shard = shard_of(key);
+        const std::lock_guard<std::mutex> lock{shard.mutex};
+
+        return shard.cache.erase(key);
+    }
+
+    // Number of entries. Shards are counted one after another, so it is
+    // only exact while no other thread changes the cache.
+    [[nodiscard]]
+    size_type size() const
+    {
+        size_type total{};
+        for (const Shard& shard : m_shards)
+        {
+            const std::lock_guard<std::mutex> lock{shard.mutex};
+            total += shard.cache.size();
+        }
+        return total;
+    }
+
+    // The counters of all shards added up.
+    [[nodiscard]]
+    LruStats stats() const
+    {
+        LruStats total{};
+        for (const Shard& shard : m_shards)
+        {
+            const std::lock_guard<std::mutex> lock{shard.mutex};
+            const LruStats stats = shard.cache.stats();
+
+            total.hits += stats.hits;
+            total.misses += stats.misses;
+            total.evictions += stats.evictions;
+        }
+        return total;
+    }
+
+    [[nodiscard]]
+    size_type shard_count() const noexcept
+    {
+        return m_shards.size();
+    }
+};
+
+#endif // LRUCACHE_HPP
@@ -1,6 +1,8 @@
 #ifndef NODE_HPP
 #define NODE_HPP
 
+#include <utility> // std::move, std::forward, std::in_place_t
+
 template <typename T>
 struct Node
 {
@@ -12,6 +14,18 @@ struct Node
         : prev{pr}, data{dat}, next{nxt}
     {
     }
+
+    Node(T&& dat, Node* pr = nullptr, Node* nxt = nullptr)
+        : prev{pr}, data{std::move(dat)}, next{nxt}
+    {
+    }
+
+    // Construct the data from "args" in place, unlinked.
+    template <typename... Args>
+    explicit Node(std::in_place_t, Args&&... args)
+        : data(std::forward<Args>(args)...)
+    {
+    }
 };
 
 #endif // NODE_HPP